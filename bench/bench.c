@@ -0,0 +1,226 @@
+#include <string.h>
+#include <time.h>
+#include "bench.h"
+#include "benchAlloc.h"
+
+#undef malloc
+#undef calloc
+#undef realloc
+#undef aligned_alloc
+
+long benchAllocations = 0;
+
+/**internal functions**/
+
+/*
+ * Function: now
+ * ----------------------------
+ * returns the time of a monotonic clock in seconds.
+ */
+double now(void){
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+int compareSamples(const void * a, const void * b){
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+/*
+ * Function: percentile
+ * ----------------------------
+ * returns the nearest rank percentile of count sorted samples.
+ */
+double percentile(double * samples, long count, double fraction){
+    long rank = (long)(fraction * count + 0.999999);
+    if(rank < 1){
+        rank = 1;
+    }
+    return samples[rank - 1];
+}
+
+/**end internal functions**/
+
+void * benchMalloc(size_t size){
+    void * pointer = malloc(size);
+    benchAllocations += pointer != NULL;
+    return pointer;
+}
+
+void * benchCalloc(size_t count, size_t size){
+    void * pointer = calloc(count, size);
+    benchAllocations += pointer != NULL;
+    return pointer;
+}
+
+void * benchRealloc(void * pointer, size_t size){
+    void * resized = realloc(pointer, size);
+    benchAllocations += resized != NULL;
+    return resized;
+}
+
+void * benchAlignedAlloc(size_t alignment, size_t size){
+    void * pointer = aligned_alloc(alignment, size);
+    benchAllocations += pointer != NULL;
+    return pointer;
+}
+
+/*
+ * Function: benchInit
+ * ----------------------------
+ * Reads the command line and prints the CSV header or opens the JSON array.
+ *
+ * bench: the benchmark to initialize.
+ * argc, argv: the command line.  Accepts --json, --csv (the default),
+ *      --min N and --max N.  Sizes run from min to max in powers of ten.
+ *
+ * return: 1 if sucessful. 0 if the command line was not understood.
+ */
+int benchInit(Bench * bench, int argc, char ** argv){
+    if(bench == NULL){
+        return 0;
+    }
+    bench->json = 0;
+    bench->minSize = BENCH_MIN_SIZE;
+    bench->maxSize = BENCH_MAX_SIZE;
+    bench->rows = 0;
+    for(int i = 1; i < argc; i++){
+        if(strcmp(argv[i], "--json") == 0){
+            bench->json = 1;
+        }
+        else if(strcmp(argv[i], "--csv") == 0){
+            bench->json = 0;
+        }
+        else if(strcmp(argv[i], "--min") == 0 && i + 1 < argc){
+            bench->minSize = atol(argv[++i]);
+        }
+        else if(strcmp(argv[i], "--max") == 0 && i + 1 < argc){
+            bench->maxSize = atol(argv[++i]);
+        }
+        else{
+            fprintf(stderr, "usage: %s [--csv | --json] [--min size] [--max size]\n", argv[0]);
+            return 0;
+        }
+    }
+    if(bench->minSize < 1){
+        bench->minSize = 1;
+    }
+    if(bench->json){
+        printf("[");
+    }
+    else{
+        printf("structure,operation,size,ops,batches,ns_per_op,ops_per_sec,allocs_per_op,p50_ns,p90_ns,p99_ns,max_ns\n");
+    }
+    return 1;
+}
+
+/*
+ * Function: benchRun
+ * ----------------------------
+ * Times an operation and prints its result.  The ops are split into
+ *      batches, each timed on its own, and the percentiles are taken over
+ *      the ns/op of the batches.
+ *
+ * bench: the benchmark being run.
+ * structure: the name of the data structure.
+ * operation: the name of the operation.
+ * size: the size of the structure being measured.
+ * ops: the total number of operations.
+ * batches: the number of batches to split the ops into.  At most
+ *      BENCH_MAX_BATCHES.
+ * setup: called before each batch, untimed.  May be NULL.
+ * body: performs ops first to first + count - 1 on context.
+ * context: passed to setup and body.
+ *
+ * return: 1 if sucessful. 0 if failed.
+ *
+ * note: only the allocations made by code compiled with benchAlloc.h are
+ *      counted, so the benchmark's own allocations are excluded.
+ */
+int benchRun(Bench * bench, char * structure, char * operation, long size, long ops, long batches,
+             void (*setup)(void * context), void (*body)(void * context, long first, long count), void * context){
+    if(bench == NULL || body == NULL || ops < 1){
+        return 0;
+    }
+    if(batches > BENCH_MAX_BATCHES){
+        batches = BENCH_MAX_BATCHES;
+    }
+    if(batches > ops){
+        batches = ops;
+    }
+    if(batches < 1){
+        batches = 1;
+    }
+    double seconds = 0;
+    long allocations = 0;
+    long first = 0;
+    for(long batch = 0; batch < batches; batch++){
+        long count = ops * (batch + 1) / batches - first;
+        if(setup != NULL){
+            setup(context);
+        }
+        long startAllocations = benchAllocations;
+        double start = now();
+        body(context, first, count);
+        double elapsed = now() - start;
+        allocations += benchAllocations - startAllocations;
+        seconds += elapsed;
+        bench->samples[batch] = elapsed * 1e9 / count;
+        first += count;
+    }
+    qsort(bench->samples, batches, sizeof(double), &compareSamples);
+
+    double nsPerOp = seconds * 1e9 / ops;
+    double opsPerSec = seconds > 0 ? ops / seconds : 0;
+    double allocsPerOp = (double)allocations / ops;
+    if(bench->json){
+        printf("%s\n  {\"structure\": \"%s\", \"operation\": \"%s\", \"size\": %ld, \"ops\": %ld, \"batches\": %ld, "
+               "\"ns_per_op\": %.2f, \"ops_per_sec\": %.0f, \"allocs_per_op\": %.4f, "
+               "\"p50_ns\": %.2f, \"p90_ns\": %.2f, \"p99_ns\": %.2f, \"max_ns\": %.2f}",
+               bench->rows == 0 ? "" : ",", structure, operation, size, ops, batches, nsPerOp, opsPerSec, allocsPerOp,
+               percentile(bench->samples, batches, 0.5), percentile(bench->samples, batches, 0.9),
+               percentile(bench->samples, batches, 0.99), bench->samples[batches - 1]);
+    }
+    else{
+        printf("%s,%s,%ld,%ld,%ld,%.2f,%.0f,%.4f,%.2f,%.2f,%.2f,%.2f\n",
+               structure, operation, size, ops, batches, nsPerOp, opsPerSec, allocsPerOp,
+               percentile(bench->samples, batches, 0.5), percentile(bench->samples, batches, 0.9),
+               percentile(bench->samples, batches, 0.99), bench->samples[batches - 1]);
+    }
+    fflush(stdout);
+    bench->rows++;
+    return 1;
+}
+
+/*
+ * Function: benchFinish
+ * ----------------------------
+ * Closes the JSON array if one was opened.
+ *
+ * bench: the benchmark to finish.
+ */
+void benchFinish(Bench * bench){
+    if(bench != NULL && bench->json){
+        printf("\n]\n");
+    }
+}
+
+/*
+ * Function: benchRandom
+ * ----------------------------
+ * A small deterministic pseudo random generator so runs are repeatable.
+ *
+ * seed: the state of the generator, updated by each call.  Must not start
+ *      at zero.
+ *
+ * return: the next pseudo random number.
+ */
+unsigned long benchRandom(unsigned long * seed){
+    *seed ^= *seed << 13;
+    *seed ^= *seed >> 7;
+    *seed ^= *seed << 17;
+    return *seed;
+}
@@ -0,0 +1,91 @@
+#include <stdlib.h>
+#include <stdio.h>
+#ifndef BENCH_H
+#define BENCH_H
+
+#define BENCH_MIN_SIZE 10
+#define BENCH_MAX_SIZE 10000000
+#define BENCH_MAX_BATCHES 1000
+
+/*
+ * Struct: Bench
+ * ----------------------------
+ * The state of a benchmark run.  Results are printed as they are measured,
+ *      one row (or JSON object) per structure, operation and size.
+ *
+ * json: 1 to print JSON, 0 to print CSV.
+ * minSize: the smallest size to measure.
+ * maxSize: the largest size to measure.
+ * rows: the number of results printed so far.
+ * samples: the ns/op of each timed batch of the current operation.
+ *
+ */
+typedef struct bench{
+    int json;
+    long minSize;
+    long maxSize;
+    int rows;
+    double samples[BENCH_MAX_BATCHES];
+}Bench;
+
+/*
+ * Function: benchInit
+ * ----------------------------
+ * Reads the command line and prints the CSV header or opens the JSON array.
+ *
+ * bench: the benchmark to initialize.
+ * argc, argv: the command line.  Accepts --json, --csv (the default),
+ *      --min N and --max N.  Sizes run from min to max in powers of ten.
+ *
+ * return: 1 if sucessful. 0 if the command line was not understood.
+ */
+int benchInit(Bench * bench, int argc, char ** argv);
+
+/*
+ * Function: benchRun
+ * ----------------------------
+ * Times an operation and prints its result.  The ops are split into
+ *      batches, each timed on its own, and the percentiles are taken over
+ *      the ns/op of the batches.
+ *
+ * bench: the benchmark being run.
+ * structure: the name of the data structure.
+ * operation: the name of the operation.
+ * size: the size of the structure being measured.
+ * ops: the total number of operations.
+ * batches: the number of batches to split the ops into.  At most
+ *      BENCH_MAX_BATCHES.
+ * setup: called before each batch, untimed.  May be NULL.
+ * body: performs ops first to first + count - 1 on context.
+ * context: passed to setup and body.
+ *
+ * return: 1 if sucessful. 0 if failed.
+ *
+ * note: only the allocations made by code compiled with benchAlloc.h are
+ *      counted, so the benchmark's own allocations are excluded.
+ */
+int benchRun(Bench * bench, char * structure, char * operation, long size, long ops, long batches,
+             void (*setup)(void * context), void (*body)(void * context, long first, long count), void * context);
+
+/*
+ * Function: benchFinish
+ * ----------------------------
+ * Closes the JSON array if one was opened.
+ *
+ * bench: the benchmark to finish.
+ */
+void benchFinish(Bench * bench);
+
+/*
+ * Function: benchRandom
+ * ----------------------------
+ * A small deterministic pseudo random generator so runs are repeatable.
+ *
+ * seed: the state of the generator, updated by each call.  Must not start
+ *      at zero.
+ *
+ * return: the next pseudo random number.
+ */
+unsigned long benchRandom(unsigned long * seed);
+
+#endif
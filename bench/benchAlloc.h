@@ -0,0 +1,31 @@
+#include <stdlib.h>
+#ifndef BENCH_ALLOC_H
+#define BENCH_ALLOC_H
+
+/*
+ * Header: benchAlloc.h
+ * ----------------------------
+ * Force included (-include) when a data structure is built for a benchmark
+ *      so that its allocations are counted.  stdlib.h is included first so
+ *      the macros below do not rename its declarations.
+ */
+
+/*
+ * Variable: benchAllocations
+ * ----------------------------
+ * The number of successful malloc, calloc, realloc and aligned_alloc calls
+ *      made by the code compiled with this header.
+ */
+extern long benchAllocations;
+
+void * benchMalloc(size_t size);
+void * benchCalloc(size_t count, size_t size);
+void * benchRealloc(void * pointer, size_t size);
+void * benchAlignedAlloc(size_t alignment, size_t size);
+
+#define malloc(size) benchMalloc(size)
+#define calloc(count, size) benchCalloc(count, size)
+#define realloc(pointer, size) benchRealloc(pointer, size)
+#define aligned_alloc(alignment, size) benchAlignedAlloc(alignment, size)
+
+#endif
@@ -0,0 +1,272 @@
+#include <unistd.h>
+#include "bench.h"
+#include "linkedList.h"
+#include "typedLinkedList.h"
+#include "intrusiveList.h"
+
+/*
+ * Benchmark: benchLinkedList
+ * ----------------------------
+ * Measures addToBackLL, getLL, searchLL, sortLL and insertSortedLL for list
+ *      lengths from 10 up to 10^7 in powers of ten.  searchLL and
+ *      insertSortedLL are measured again with a hash index on the unsorted
+ *      list and a skip index on the sorted list, and sortLL again with one
+ *      thread per processor.  arraySortLL is measured on the same list and
+ *      data as sortLL, whose nodes sortLL has left out of memory order.
+ *      addToBack, search and sort are also measured on an IntList made by
+ *      DEFINE_LINKED_LIST, which stores the values in its nodes, and with
+ *      addToBackIL, searchIL and sortIL on an IntrusiveList of items that
+ *      carry their own links.
+ *
+ * usage: benchLinkedList [--csv | --json] [--min size] [--max size]
+ *
+ * output: one row per operation and length, see bench.h.
+ */
+
+DEFINE_LINKED_LIST(IntList, int, LL_COMPARE_VALUES)
+
+typedef struct intItem{
+    int value;
+    IntrusiveLink link;
+}IntItem;
+
+typedef struct listContext{
+    LinkedList * list;
+    IntList * intList;
+    IntrusiveList * intrusiveList;
+    IntItem * items;
+    long found;
+    int * values;
+    long size;
+    unsigned long seed;
+}ListContext;
+
+void noDestroyFunc(void * data){
+}
+
+int compareFunc(void * a, void * b){
+    return (*(int*)a > *(int*)b) - (*(int*)a < *(int*)b);
+}
+
+int compareItems(void * a, void * b){
+    IntItem * x = a;
+    IntItem * y = b;
+    return (x->value > y->value) - (x->value < y->value);
+}
+
+unsigned long hashFunc(void * data){
+    return (unsigned long)*(int*)data * 0x9E3779B97F4A7C15ul;
+}
+
+/*
+ * Function: probesFor
+ * ----------------------------
+ * returns the number of O(n) operations to time for a list of size items.
+ */
+long probesFor(long size){
+    return size <= 10000 ? 1000 : size <= 1000000 ? 100 : 10;
+}
+
+void addToBackBody(void * context, long first, long count){
+    ListContext * c = context;
+    for(long i = first; i < first + count; i++){
+        addToBackLL(c->list, &c->values[i]);
+    }
+}
+
+void getRandomBody(void * context, long first, long count){
+    ListContext * c = context;
+    for(long i = 0; i < count; i++){
+        getLL(c->list, benchRandom(&c->seed) % c->size);
+    }
+}
+
+void getSequentialBody(void * context, long first, long count){
+    ListContext * c = context;
+    for(long i = first; i < first + count; i++){
+        getLL(c->list, i);
+    }
+}
+
+void searchBody(void * context, long first, long count){
+    ListContext * c = context;
+    for(long i = 0; i < count; i++){
+        searchLL(c->list, &c->values[benchRandom(&c->seed) % c->size]);
+    }
+}
+
+/*
+ * Function: unsortSetup
+ * ----------------------------
+ * puts the values back into the list in their original random order.
+ */
+void unsortSetup(void * context){
+    ListContext * c = context;
+    long i = 0;
+    for(LinkedListNode * node = c->list->head; node != NULL; node = node->prev){
+        node->data = &c->values[i++];
+    }
+    c->list->sorted = 0;
+}
+
+void sortBody(void * context, long first, long count){
+    ListContext * c = context;
+    for(long i = 0; i < count; i++){
+        sortLL(c->list);
+    }
+}
+
+void arraySortBody(void * context, long first, long count){
+    ListContext * c = context;
+    for(long i = 0; i < count; i++){
+        arraySortLL(c->list);
+    }
+}
+
+void intAddToBackBody(void * context, long first, long count){
+    ListContext * c = context;
+    for(long i = first; i < first + count; i++){
+        addToBackIntList(c->intList, c->values[i]);
+    }
+}
+
+void intSearchBody(void * context, long first, long count){
+    ListContext * c = context;
+    for(long i = 0; i < count; i++){
+        c->found += searchIntList(c->intList, c->values[benchRandom(&c->seed) % c->size]);
+    }
+}
+
+/*
+ * Function: intUnsortSetup
+ * ----------------------------
+ * puts the values back into the IntList in their original random order.
+ */
+void intUnsortSetup(void * context){
+    ListContext * c = context;
+    long i = 0;
+    for(IntListNode * node = c->intList->head; node != NULL; node = node->prev){
+        node->value = c->values[i++];
+    }
+    c->intList->sorted = 0;
+}
+
+void intSortBody(void * context, long first, long count){
+    ListContext * c = context;
+    for(long i = 0; i < count; i++){
+        sortIntList(c->intList);
+    }
+}
+
+void addToBackILBody(void * context, long first, long count){
+    ListContext * c = context;
+    for(long i = first; i < first + count; i++){
+        addToBackIL(c->intrusiveList, &c->items[i]);
+    }
+}
+
+void searchILBody(void * context, long first, long count){
+    ListContext * c = context;
+    IntItem probe;
+    for(long i = 0; i < count; i++){
+        probe.value = c->values[benchRandom(&c->seed) % c->size];
+        c->found += searchIL(c->intrusiveList, &probe);
+    }
+}
+
+/*
+ * Function: unsortILSetup
+ * ----------------------------
+ * puts the values back into the items of the IntrusiveList in their
+ *      original random order.
+ */
+void unsortILSetup(void * context){
+    ListContext * c = context;
+    long i = 0;
+    for(IntrusiveLink * link = c->intrusiveList->head; link != NULL; link = link->prev){
+        IL_ENTRY(link, IntItem, link)->value = c->values[i++];
+    }
+    c->intrusiveList->sorted = 0;
+}
+
+void sortILBody(void * context, long first, long count){
+    ListContext * c = context;
+    for(long i = 0; i < count; i++){
+        sortIL(c->intrusiveList);
+    }
+}
+
+void insertSortedBody(void * context, long first, long count){
+    ListContext * c = context;
+    for(long i = 0; i < count; i++){
+        insertSortedLL(c->list, &c->values[benchRandom(&c->seed) % c->size]);
+    }
+}
+
+int main(int argc, char ** argv){
+    Bench bench;
+    ListContext context;
+    if(!benchInit(&bench, argc, argv)){
+        return 1;
+    }
+    context.values = malloc(sizeof(int) * bench.maxSize);
+    context.items = malloc(sizeof(IntItem) * bench.maxSize);
+    if(context.values == NULL || context.items == NULL){
+        return 1;
+    }
+    long threads = sysconf(_SC_NPROCESSORS_ONLN);
+    threads = threads < 2 ? 2 : threads > LL_MAX_SORT_THREADS ? LL_MAX_SORT_THREADS : threads;
+    context.seed = 42;
+    context.found = 0;
+    for(long i = 0; i < bench.maxSize; i++){
+        context.values[i] = (int)(benchRandom(&context.seed) >> 33);
+        context.items[i].value = context.values[i];
+    }
+
+    for(long size = bench.minSize; size <= bench.maxSize; size *= 10){
+        long probes = probesFor(size);
+        long sorts = size <= 100000 ? 10 : size <= 1000000 ? 3 : 1;
+        context.size = size;
+
+        context.list = createPooledLinkedList(&noDestroyFunc, &compareFunc, LL_DEFAULT_SLAB_SIZE);
+        benchRun(&bench, "pooledLinkedList", "addToBackLL", size, size, size / 10, NULL, &addToBackBody, &context);
+        destroyLinkedList(context.list);
+
+        context.intList = createIntList();
+        benchRun(&bench, "intList", "addToBack", size, size, size / 10, NULL, &intAddToBackBody, &context);
+        benchRun(&bench, "intList", "search", size, probes, probes, NULL, &intSearchBody, &context);
+        benchRun(&bench, "intList", "sort", size, sorts, sorts, &intUnsortSetup, &intSortBody, &context);
+        destroyIntList(context.intList);
+
+        context.intrusiveList = createIntrusiveList(offsetof(IntItem, link), NULL, &compareItems);
+        benchRun(&bench, "intrusiveList", "addToBackIL", size, size, size / 10, NULL, &addToBackILBody, &context);
+        benchRun(&bench, "intrusiveList", "searchIL", size, probes, probes, NULL, &searchILBody, &context);
+        benchRun(&bench, "intrusiveList", "sortIL", size, sorts, sorts, &unsortILSetup, &sortILBody, &context);
+        destroyIntrusiveList(context.intrusiveList);
+
+        context.list = createLinkedList(&noDestroyFunc, &compareFunc);
+        benchRun(&bench, "linkedList", "addToBackLL", size, size, size / 10, NULL, &addToBackBody, &context);
+        benchRun(&bench, "linkedList", "getLL_sequential", size, size, size / 10, NULL, &getSequentialBody, &context);
+        benchRun(&bench, "linkedList", "getLL_random", size, probes, probes, NULL, &getRandomBody, &context);
+        benchRun(&bench, "linkedList", "searchLL", size, probes, probes, NULL, &searchBody, &context);
+        enableHashIndexLL(context.list, &hashFunc);
+        benchRun(&bench, "hashIndexedLinkedList", "searchLL", size, probes, probes, NULL, &searchBody, &context);
+        disableHashIndexLL(context.list);
+        benchRun(&bench, "linkedList", "sortLL", size, sorts, sorts, &unsortSetup, &sortBody, &context);
+        setSortThreadsLL(context.list, threads, 1);
+        benchRun(&bench, "linkedList", "sortLL_parallel", size, sorts, sorts, &unsortSetup, &sortBody, &context);
+        setSortThreadsLL(context.list, 1, 0);
+        benchRun(&bench, "linkedList", "arraySortLL", size, sorts, sorts, &unsortSetup, &arraySortBody, &context);
+        benchRun(&bench, "linkedList", "insertSortedLL", size, probes, probes, NULL, &insertSortedBody, &context);
+
+        enableSkipIndexLL(context.list);
+        searchLL(context.list, &context.values[0]);
+        benchRun(&bench, "skipIndexedLinkedList", "searchLL", size, probes, probes, NULL, &searchBody, &context);
+        benchRun(&bench, "skipIndexedLinkedList", "insertSortedLL", size, probes, probes, NULL, &insertSortedBody, &context);
+        destroyLinkedList(context.list);
+    }
+    benchFinish(&bench);
+    free(context.values);
+    free(context.items);
+    return 0;
+}
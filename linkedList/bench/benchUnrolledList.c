@@ -0,0 +1,132 @@
+#include <stdio.h>
+#include <time.h>
+#include "linkedList.h"
+#include "unrolledList.h"
+
+/*
+ * Benchmark: benchUnrolledList
+ * ----------------------------
+ * Measures the UnrolledList against the LinkedList for the operations they
+ *      share: appending, random gets, searching, sorting and sorted inserts.
+ *
+ * usage: benchUnrolledList [maxLength]
+ *      maxLength defaults to 100000.  Lengths grow by ten from 100.
+ *
+ * output: CSV with one row per list type, operation and length.
+ */
+
+#define PROBES 1000
+
+void noDestroyFunc(void * data){
+}
+
+int compareFunc(void * a, void * b){
+    return (*(int*)a > *(int*)b) - (*(int*)a < *(int*)b);
+}
+
+double now(void){
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+void report(char * list, char * operation, int length, long ops, double seconds){
+    printf("%s,%s,%d,%ld,%.6f,%.1f\n", list, operation, length, ops, seconds, seconds * 1e9 / ops);
+}
+
+void benchLinkedList(int * values, int length){
+    LinkedList * list = createLinkedList(&noDestroyFunc, &compareFunc);
+    unsigned int seed = 1;
+    int found = 0;
+    double start = now();
+    for(int i = 0; i < length; i++){
+        addToBackLL(list, &values[i]);
+    }
+    report("linked", "addToBack", length, length, now() - start);
+
+    start = now();
+    for(int i = 0; i < PROBES; i++){
+        seed = seed * 1103515245 + 12345;
+        found += getLL(list, (seed >> 8) % length) != NULL;
+    }
+    report("linked", "getRandom", length, PROBES, now() - start);
+
+    start = now();
+    for(int i = 0; i < PROBES / 10; i++){
+        found += searchLL(list, &values[(i * 7919) % length]) >= 0;
+    }
+    report("linked", "search", length, PROBES / 10, now() - start);
+
+    start = now();
+    sortLL(list);
+    report("linked", "sort", length, length, now() - start);
+
+    start = now();
+    for(int i = 0; i < PROBES / 10; i++){
+        insertSortedLL(list, &values[i]);
+    }
+    report("linked", "insertSorted", length, PROBES / 10, now() - start);
+    destroyLinkedList(list);
+    if(found == 0){
+        fprintf(stderr, "nothing found\n");
+    }
+}
+
+void benchUnrolledList(int * values, int length){
+    UnrolledList * list = createUnrolledList(&noDestroyFunc, &compareFunc);
+    unsigned int seed = 1;
+    int found = 0;
+    double start = now();
+    for(int i = 0; i < length; i++){
+        addToBackUL(list, &values[i]);
+    }
+    report("unrolled", "addToBack", length, length, now() - start);
+
+    start = now();
+    for(int i = 0; i < PROBES; i++){
+        seed = seed * 1103515245 + 12345;
+        found += getUL(list, (seed >> 8) % length) != NULL;
+    }
+    report("unrolled", "getRandom", length, PROBES, now() - start);
+
+    start = now();
+    for(int i = 0; i < PROBES / 10; i++){
+        found += searchUL(list, &values[(i * 7919) % length]) >= 0;
+    }
+    report("unrolled", "search", length, PROBES / 10, now() - start);
+
+    start = now();
+    sortUL(list);
+    report("unrolled", "sort", length, length, now() - start);
+
+    start = now();
+    for(int i = 0; i < PROBES / 10; i++){
+        insertSortedUL(list, &values[i]);
+    }
+    report("unrolled", "insertSorted", length, PROBES / 10, now() - start);
+    destroyUnrolledList(list);
+    if(found == 0){
+        fprintf(stderr, "nothing found\n");
+    }
+}
+
+int main(int argc, char ** argv){
+    int maxLength = argc > 1 ? atoi(argv[1]) : 100000;
+    int * values = malloc(sizeof(int) * maxLength);
+    unsigned int seed = 42;
+    if(values == NULL){
+        return 1;
+    }
+    for(int i = 0; i < maxLength; i++){
+        seed = seed * 1103515245 + 12345;
+        values[i] = seed >> 8;
+    }
+
+    printf("list,operation,length,ops,seconds,ns_per_op\n");
+    for(int length = 100; length <= maxLength; length *= 10){
+        benchLinkedList(values, length);
+        benchUnrolledList(values, length);
+    }
+    free(values);
+    return 0;
+}
@@ -0,0 +1,210 @@
+#include <stdlib.h>
+#include <stddef.h>
+#ifndef INTRUSIVE_LIST_H
+#define INTRUSIVE_LIST_H
+
+#define IL_SORT_BINS 64
+
+/*
+ * Struct: IntrusiveLink
+ * ----------------------------
+ * The links of an item in an intrusive list.  The caller embeds one in the
+ *      struct of each item, so adding an item allocates nothing and walking
+ *      the list touches only the items themselves.  The links are used the
+ *      same way as those of a LinkedListNode.
+ *
+ * next: the link of the item before this one, towards the head
+ * prev: the link of the item after this one, towards the tail
+ */
+typedef struct intrusiveLink{
+    struct intrusiveLink * next;
+    struct intrusiveLink * prev;
+}IntrusiveLink;
+
+/*
+ * Macro: IL_ENTRY
+ * ----------------------------
+ * Returns the item that contains a link.
+ *
+ * link: a pointer to the IntrusiveLink inside the item.
+ * type: the type of the item.
+ * member: the name of the IntrusiveLink field within type.
+ */
+#define IL_ENTRY(link, type, member) ((type *)((char *)(link) - offsetof(type, member)))
+
+/*
+ * Struct: IntrusiveList
+ * ----------------------------
+ * Represents a doubly linked list of items that carry their own links.
+ *      The items are passed in and returned as pointers to the items
+ *      themselves, like the data of a LinkedList.
+ *
+ * head: the link of the front item; index 0.
+ * tail: the link of the end item.
+ * offset: the offset of the IntrusiveLink within each item, from
+ *      offsetof.
+ * destroyData: a function pointer that is used to free the items still in
+ *      the list when it is destroyed.  NULL to leave them to the caller.
+ * compareData: a function pointer that is used to compare two items
+ *      in the list
+ * length: the number of items in the list
+ * sorted: 1=sorted 0=unsorted
+ *
+ */
+typedef struct intrusiveList{
+    IntrusiveLink * head;
+    IntrusiveLink * tail;
+    size_t offset;
+    void (*destroyData)(void * data);
+    int (*compareData)(void * a, void * b);
+    int length;
+    int sorted;
+}IntrusiveList;
+
+/*
+ * Function: createIntrusiveList
+ * ----------------------------
+ * Creates a pointer to an intrusive list data structure
+ *
+ * offset: the offset of the IntrusiveLink within the items, e.g.
+ *      offsetof(Job, link).  An item may be in several lists at once
+ *      through different links.
+ * destroyFunc: a function pointer that destroys the items left in the
+ *      list when it is destroyed.  May be NULL.
+ * compareFunc: a function pointer that compares two items.
+ *
+ * return: a pointer to the created list.  NULL if failed.
+ */
+IntrusiveList * createIntrusiveList(size_t offset, void (*destroyFunc)(void * data), int (*compareFunc)(void * a, void * b));
+
+/*
+ * Function: addToFrontIL
+ * ----------------------------
+ * Adds an item to the front of the list
+ *
+ * list: the list to perform the add to front operation on.
+ * data: the item to add.  Its link must not be in use by another list.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int addToFrontIL(IntrusiveList * list, void * data);
+
+/*
+ * Function: addToBackIL
+ * ----------------------------
+ * Adds an item to the end of the list
+ *
+ * list: the list to perform the add to back operation on.
+ * data: the item to add.  Its link must not be in use by another list.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int addToBackIL(IntrusiveList * list, void * data);
+
+/*
+ * Function: insertAtIndexIL
+ * ----------------------------
+ * Adds an item at the given index of the list
+ *
+ * list: the list to perform the insert operation on.
+ * data: the item to add.  Its link must not be in use by another list.
+ * index: the index the item will have.  From 0 to the length of the list.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int insertAtIndexIL(IntrusiveList * list, void * data, int index);
+
+/*
+ * Function: removeFromIndexIL
+ * ----------------------------
+ * removes the item at the index and returns it.
+ *
+ * list: the list to perform the remove operation on.
+ * index: the index of the item to be removed.
+ *
+ * return: the removed item.  NULL if the index is out of bounds.
+ */
+void * removeFromIndexIL(IntrusiveList * list, int index);
+
+/*
+ * Function: removeIL
+ * ----------------------------
+ * removes an item from the list in O(1) without searching for it.
+ *
+ * list: the list to perform the remove operation on.
+ * data: the item to remove.  Must be in the list.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int removeIL(IntrusiveList * list, void * data);
+
+/*
+ * Function: getIL
+ * ----------------------------
+ * retrieve the item at the given index.
+ *
+ * list: the list to perform the get operation on.
+ * index: the index of the item to retrieve.
+ *
+ * return: the item at the given index.  NULL if out of bounds.
+ */
+void * getIL(IntrusiveList * list, int index);
+
+/*
+ * Function: searchIL
+ * ----------------------------
+ * Sequentially checks each item.  A sorted list is only checked up to the
+ *      first item greater than the one searched for.
+ *
+ * list: the list to perform the search operation on.
+ * data: the item to be found.
+ *
+ * return: the index of the first item that compares equal.  -1 if not
+ *      found.
+ */
+int searchIL(IntrusiveList * list, void * data);
+
+/*
+ * Function: insertSortedIL
+ * ----------------------------
+ * insert an item into a sorted list, after any equal items.
+ *
+ * list: the list to perform the insert operation on.
+ * data: the item to add.  Its link must not be in use by another list.
+ *
+ * return: the index the item was inserted to.  -1 if failed.
+ */
+int insertSortedIL(IntrusiveList * list, void * data);
+
+/*
+ * Function: sortIL
+ * ----------------------------
+ * Sorts the list with the same stable bottom up natural merge sort as
+ *      sortLL, relinking the items without allocating.
+ *
+ * list: the list to perform the sort operation on.
+ *
+ * return: 1 if sucessful. 0 if failed.
+ */
+int sortIL(IntrusiveList * list);
+
+/*
+ * Function: destroyIntrusiveList
+ * ----------------------------
+ * Frees the list, and the items left in it if it has a destroyData.
+ *
+ * list: the list to be destroyed.
+ *
+ * return: 1 if sucessful. 0 if failed.
+ */
+int destroyIntrusiveList(IntrusiveList * list);
+
+#endif
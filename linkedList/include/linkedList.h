@@ -1,6 +1,14 @@
 #include <stdlib.h>
 #include <stdio.h>
 
+#define LL_DEFAULT_SLAB_SIZE 256
+#define LL_SORT_BINS 64
+#define LL_SKIP_MAX_LEVEL 16
+#define LL_HASH_INITIAL_CAPACITY 16
+#define LL_MAX_SORT_THREADS 64
+#define LL_DEFAULT_SORT_CUTOFF 100000
+#define LL_ARRAY_SORT_RUN 32
+
 /*
  * Struct: Node
  * ----------------------------
@@ -17,6 +25,123 @@ typedef struct linkedListNode{
     void * data;
 }LinkedListNode;
 
+/*
+ * Struct: LinkedListSlab
+ * ----------------------------
+ * A contiguous block of nodes allocated at once by a node pool.
+ *
+ * next: the next slab owned by the same pool
+ * nodes: the nodes carved out of this slab
+ */
+typedef struct linkedListSlab{
+    struct linkedListSlab * next;
+    LinkedListNode nodes[];
+}LinkedListSlab;
+
+/*
+ * Struct: LinkedListNodePool
+ * ----------------------------
+ * A per list node allocator.  Nodes are carved out of slabs and recycled
+ *      through an intrusive free list threaded through the prev pointer of
+ *      unused nodes, so adding and removing items does not call malloc or free
+ *      once the pool has grown to the working size of the list.
+ *
+ * slabs: the slabs owned by the pool
+ * freeNodes: the first unused node
+ * slabSize: the number of nodes allocated per slab
+ * users: the number of lists allocating from the pool.  A list made by
+ *      splitAtLL shares the pool of the list it was split from, and the
+ *      pool is freed along with the last of them.  Lists sharing a pool
+ *      may not be used from different threads at the same time.
+ */
+typedef struct linkedListNodePool{
+    LinkedListSlab * slabs;
+    LinkedListNode * freeNodes;
+    int slabSize;
+    int users;
+}LinkedListNodePool;
+
+/*
+ * Struct: LinkedListSkipNode
+ * ----------------------------
+ * An entry of a skip index.  About one in four nodes of the list is given
+ *      an entry, and each entry is linked into between one and
+ *      LL_SKIP_MAX_LEVEL levels of express lanes over the list.
+ *
+ * node: the list node the entry refers to.  NULL for the header.
+ * levels: for each level the entry is in, the next entry towards the tail
+ *      and the span, the number of list positions from this entry to it.
+ *      The span is unused when next is NULL.
+ */
+typedef struct linkedListSkipNode{
+    LinkedListNode * node;
+    struct linkedListSkipLevel{
+        struct linkedListSkipNode * next;
+        int span;
+    }levels[];
+}LinkedListSkipNode;
+
+/*
+ * Struct: LinkedListSkipIndex
+ * ----------------------------
+ * An optional skip list layered over a sorted linked list that lets searchLL
+ *      and insertSortedLL find a position in O(log n) expected comparisons.
+ *      The entries are freed whenever the list changes in a way that may
+ *      leave it unsorted and are rebuilt on the next search.
+ *
+ * header: the entry before index 0, linked into every level.
+ * level: the number of levels in use.
+ * built: 1 if the entries match the list.  0 if they must be rebuilt.
+ * seed: the state of the generator used to pick the level of new entries.
+ */
+typedef struct linkedListSkipIndex{
+    LinkedListSkipNode * header;
+    int level;
+    int built;
+    unsigned int seed;
+}LinkedListSkipIndex;
+
+/*
+ * Struct: LinkedListHashEntry
+ * ----------------------------
+ * A slot of a hash index.
+ *
+ * node: the list node the slot refers to.  NULL if the slot is empty.
+ * hash: the hash of the node's data.
+ * label: a number that increases from head to tail.  The index of the node
+ *      is its label minus the label of the head while the labels are valid.
+ */
+typedef struct linkedListHashEntry{
+    LinkedListNode * node;
+    unsigned long hash;
+    long label;
+}LinkedListHashEntry;
+
+/*
+ * Struct: LinkedListHashIndex
+ * ----------------------------
+ * An optional open addressing hash table from items to the nodes holding
+ *      them, kept up to date by every insert and remove, so searchLL finds
+ *      an item in O(1) average instead of comparing against every node.
+ *
+ * entries: the slots of the table, probed linearly.
+ * capacity: the number of slots.  A power of two kept at least twice count.
+ * count: the number of nodes in the table.
+ * firstLabel: the label of the head.
+ * lastLabel: the label of the tail.
+ * labelled: 1 if the labels are valid.  Adding to or removing from either
+ *      end keeps them valid; any other change clears the flag and the
+ *      labels are renumbered the next time an index is needed.
+ */
+typedef struct linkedListHashIndex{
+    LinkedListHashEntry * entries;
+    int capacity;
+    int count;
+    long firstLabel;
+    long lastLabel;
+    int labelled;
+}LinkedListHashIndex;
+
 /*
  * Struct: LinkedList
  * ----------------------------
@@ -28,7 +153,22 @@ typedef struct linkedListNode{
  *      stored in the linked list
  * compareData: a function pointer that is used to compare two items
  *      in the linked list
+ * hashData: a function pointer that hashes an item.  Items that compare
+ *      equal must hash equal.  NULL unless set by enableHashIndexLL.
  * sorted: 1=sorted 0=unsorted
+ * pool: the node pool used to allocate nodes.  NULL if nodes are
+ *      allocated individually with malloc.
+ * cursor: the node most recently reached by index.  Index based functions
+ *      start walking from it when it is closer than the head or tail, so
+ *      scanning the list in index order is O(1) per call.  NULL if unset.
+ * cursorIndex: the index of the cursor node.
+ * skipIndex: the skip index used while the list is sorted.  NULL unless
+ *      enabled with enableSkipIndexLL.
+ * hashIndex: the hash index used by searchLL.  NULL unless enabled with
+ *      enableHashIndexLL.
+ * sortThreads: the number of threads sortLL may use.  1 unless set by
+ *      setSortThreadsLL.
+ * sortCutoff: the smallest length sortLL sorts with more than one thread.
  * 
  */
 typedef struct linkedList{
@@ -36,10 +176,37 @@ typedef struct linkedList{
     LinkedListNode * tail;
     void (*destroyData)(void * data);
     int (*compareData)(void * a, void * b);
+    unsigned long (*hashData)(void * data);
     int length;
     int sorted;
+    LinkedListNodePool * pool;
+    LinkedListNode * cursor;
+    int cursorIndex;
+    LinkedListSkipIndex * skipIndex;
+    LinkedListHashIndex * hashIndex;
+    int sortThreads;
+    int sortCutoff;
 }LinkedList;
 
+/*
+ * Struct: LinkedListIterator
+ * ----------------------------
+ * A position in a linked list used to walk the list in either direction
+ *      and to insert or remove items in O(1) while walking.
+ *      
+ * list: the linked list being iterated over.
+ * node: the node the iterator is on.  NULL once it has run off either end.
+ * index: the index of node.
+ * 
+ * note: an iterator stays valid across changes made through itself, but
+ *      changes made any other way may leave it pointing at a removed node.
+ */
+typedef struct linkedListIterator{
+    LinkedList * list;
+    LinkedListNode * node;
+    int index;
+}LinkedListIterator;
+
 /*
  * Function: createLinkedList
  * ----------------------------
@@ -53,6 +220,22 @@ typedef struct linkedList{
  */
 LinkedList * createLinkedList(void (*destroyFunc)(void * data), int (*compareFun)(void * a, void * b));
 
+/*
+ * Function: createPooledLinkedList
+ * ----------------------------
+ * Creates a pointer to a linked list data structure that allocates its
+ *      nodes from a node pool instead of calling malloc for every node.
+ * 
+ * destroyFunc: a function pointer that destroys the data type intended
+ *      to be stored in the stack
+ * compareFunc: a function pointer that compares two of the intended data type.
+ * slabSize: the number of nodes allocated at once when the pool runs out
+ *      of free nodes.  A value less than one uses LL_DEFAULT_SLAB_SIZE.
+ * 
+ * return: a pointer to the created linked list.  NULL if failed.
+ */
+LinkedList * createPooledLinkedList(void (*destroyFunc)(void * data), int (*compareFunc)(void * a, void * b), int slabSize);
+
 /*
  * Function: addToFrontLL
  * ----------------------------
@@ -129,6 +312,9 @@ void * getLL(LinkedList * list, int index);
  * data: the item to be found.
  * 
  * return: the index of the item searched for.  -1 if not found.
+ *
+ * note: a list with a hash index is searched in O(1) average, and a sorted
+ *      list with a skip index in O(log n).
  */
 int searchLL(LinkedList * list, void * data);
 
@@ -141,13 +327,85 @@ int searchLL(LinkedList * list, void * data);
  * data: the item to be inserted into the list.
  * 
  * return: the index the item was inserted to.  -1 if failed.
+ *
+ * note: the position is found in O(log n) if the list has a skip index.
  */
 int insertSortedLL(LinkedList * list, void * data);
 
+/*
+ * Function: enableSkipIndexLL
+ * ----------------------------
+ * Attaches a skip index to the list.  The index is built the first time
+ *      searchLL or insertSortedLL is called while the list is sorted, kept
+ *      up to date by insertSortedLL and removals, and dropped by any other
+ *      insert and by sortLL until it is next needed.
+ *
+ * list: the linked list to index.
+ *
+ * return: 1 if sucessful. 0 if failed.
+ */
+int enableSkipIndexLL(LinkedList * list);
+
+/*
+ * Function: disableSkipIndexLL
+ * ----------------------------
+ * Frees the skip index of the list.
+ *
+ * list: the linked list to stop indexing.
+ *
+ * return: 1 if sucessful. 0 if failed.
+ */
+int disableSkipIndexLL(LinkedList * list);
+
+/*
+ * Function: enableHashIndexLL
+ * ----------------------------
+ * Attaches a hash index to the list and adds every item already in it.
+ *      From then on searchLL and containsLL look items up by hash.
+ *
+ * list: the linked list to index.
+ * hashFunc: a function pointer that hashes the intended data type.  Items
+ *      that compare equal must hash equal.
+ *
+ * return: 1 if sucessful. 0 if failed.
+ *
+ * note: the data of an item must not be changed in a way that changes its
+ *      hash while it is in an indexed list.
+ */
+int enableHashIndexLL(LinkedList * list, unsigned long (*hashFunc)(void * data));
+
+/*
+ * Function: disableHashIndexLL
+ * ----------------------------
+ * Frees the hash index of the list.
+ *
+ * list: the linked list to stop indexing.
+ *
+ * return: 1 if sucessful. 0 if failed.
+ */
+int disableHashIndexLL(LinkedList * list);
+
+/*
+ * Function: containsLL
+ * ----------------------------
+ * Checks whether an item equal to data is in the list.  O(1) average with
+ *      a hash index, otherwise a sequential scan.
+ *
+ * list: the linked list to check.
+ * data: the item to look for.
+ *
+ * return: 1 if the item is in the list. 0 if not or the list is NULL.
+ */
+int containsLL(LinkedList * list, void * data);
+
 /*
  * Function: sortLL
  * ----------------------------
- * Sorts the linked list using a merge sort algorithm
+ * Sorts the linked list using a stable bottom up merge sort algorithm.
+ *      Runs that are already sorted are merged as a whole, so a sorted or
+ *      reverse sorted list is handled in linear time.  Lists of at least
+ *      sortCutoff items are sorted on sortThreads threads, see
+ *      setSortThreadsLL.
  * 
  * list: the linked list to perform sort operation on.
  * 
@@ -155,6 +413,226 @@ int insertSortedLL(LinkedList * list, void * data);
  */
 int sortLL(LinkedList * list);
 
+/*
+ * Function: setSortThreadsLL
+ * ----------------------------
+ * Sets the number of threads sortLL uses.  A list of at least cutoff items
+ *      is cut into one segment per thread and the segments are sorted at
+ *      the same time.  The sorted segments are then merged in pairs, each
+ *      round of pairs also at the same time, until one list is left.
+ *      Shorter lists are sorted on the calling thread.
+ * 
+ * list: the linked list to configure.
+ * threads: the number of threads, from 1, which always sorts on the
+ *      calling thread, up to LL_MAX_SORT_THREADS.
+ * cutoff: the smallest list sorted on more than one thread.  A value less
+ *      than one uses LL_DEFAULT_SORT_CUTOFF.
+ * 
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ * 
+ * note: compareData is called from several threads at once and must be
+ *      safe to call that way.
+ */
+int setSortThreadsLL(LinkedList * list, int threads, int cutoff);
+
+/*
+ * Function: arraySortLL
+ * ----------------------------
+ * Sorts the linked list by copying its data into an array, sorting the
+ *      array with a stable merge sort and writing the data back into the
+ *      nodes in order.  The nodes are not relinked, so they are walked in
+ *      memory order twice instead of being chased by every merge, which is
+ *      faster than sortLL on large lists whose nodes are scattered.
+ * 
+ * list: the linked list to perform sort operation on.
+ * 
+ * return: 1 if sucessful. 0 if failed.
+ * 
+ * note: needs memory for two pointers per item.  If it cannot be allocated
+ *      the list is sorted with sortLL instead.  Each node keeps its index,
+ *      so the data an iterator is on may change.
+ */
+int arraySortLL(LinkedList * list);
+
+/*
+ * Function: spliceLL
+ * ----------------------------
+ * Moves count items starting at index first of src into dest in front of
+ *      index, keeping their order.  The nodes are relinked rather than
+ *      copied, so only the ends of the range are searched for.
+ * 
+ * dest: the linked list to move the items into.
+ * index: the index in dest the first moved item will have.
+ * src: the linked list to move the items out of.  Must not be dest.
+ * first: the index in src of the first item to move.
+ * count: the number of items to move.
+ * 
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure, neither list is changed
+ * 1: success
+ * 
+ * note: if the lists allocate their nodes from different places, one
+ *      pooled and one not or from two different pools, dest allocates new
+ *      nodes for the items instead.  Iterators on either list may be left
+ *      on the wrong index.
+ */
+int spliceLL(LinkedList * dest, int index, LinkedList * src, int first, int count);
+
+/*
+ * Function: concatLL
+ * ----------------------------
+ * Moves every item of b to the back of a, leaving b empty.  O(1) when the
+ *      lists allocate from the same place and neither is indexed.
+ * 
+ * a: the linked list to append to.
+ * b: the linked list to append.  Must not be a.
+ * 
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure, neither list is changed
+ * 1: success
+ */
+int concatLL(LinkedList * a, LinkedList * b);
+
+/*
+ * Function: mergeSortedLL
+ * ----------------------------
+ * Merges the items of src into dest in order, leaving src empty.  Both
+ *      lists must be sorted.  The nodes of src are relinked by a single
+ *      linear merge rather than re-sorting, so it takes O(n + m)
+ *      comparisons and dest stays sorted.
+ * 
+ * dest: the sorted linked list to merge into.
+ * src: the sorted linked list to merge from.  Must not be dest.
+ * 
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure, neither list is changed
+ * 1: success
+ * 
+ * note: the merge is stable, items of dest come before equal items of src.
+ *      If the lists allocate their nodes from different places dest
+ *      allocates new nodes for the items of src, as with spliceLL.
+ */
+int mergeSortedLL(LinkedList * dest, LinkedList * src);
+
+/*
+ * Function: splitAtLL
+ * ----------------------------
+ * Moves the items from index to the end of the list into a new list.  The
+ *      new list shares the node pool of the list, if it has one, so the
+ *      nodes are relinked rather than copied.
+ * 
+ * list: the linked list to split.
+ * index: the index of the first item to move.  The list's length gives an
+ *      empty new list.
+ * 
+ * return: a pointer to the new list holding the moved items.  NULL if
+ *      failed, in which case the list is not changed.
+ * 
+ * note: A list and the lists split from it that share a pool may not be
+ *      used from different threads at the same time, since the pool's free
+ *      list is not locked.
+ */
+LinkedList * splitAtLL(LinkedList * list, int index);
+
+/*
+ * Function: iterBeginLL
+ * ----------------------------
+ * Creates an iterator positioned at the head of the list.
+ * 
+ * list: the linked list to iterate over.
+ * 
+ * return: an iterator on index 0.  The iterator is not valid if the list
+ *      is empty or NULL.
+ */
+LinkedListIterator iterBeginLL(LinkedList * list);
+
+/*
+ * Function: iterEndLL
+ * ----------------------------
+ * Creates an iterator positioned at the tail of the list, for walking the
+ *      list backwards.
+ * 
+ * list: the linked list to iterate over.
+ * 
+ * return: an iterator on the last index.  The iterator is not valid if the
+ *      list is empty or NULL.
+ */
+LinkedListIterator iterEndLL(LinkedList * list);
+
+/*
+ * Function: iterValidLL
+ * ----------------------------
+ * Checks whether the iterator is positioned on an item.
+ * 
+ * iterator: the iterator to check.
+ * 
+ * return: 1 if the iterator is on an item. 0 if it has run off either end.
+ */
+int iterValidLL(LinkedListIterator * iterator);
+
+/*
+ * Function: iterGetLL
+ * ----------------------------
+ * retrieve the item the iterator is positioned on.
+ * 
+ * iterator: the iterator to read.
+ * 
+ * return: a pointer of the data at the iterator.  NULL if not valid.
+ */
+void * iterGetLL(LinkedListIterator * iterator);
+
+/*
+ * Function: iterNextLL
+ * ----------------------------
+ * moves the iterator one item towards the tail.
+ * 
+ * iterator: the iterator to move.
+ * 
+ * return: 1 if the iterator is on an item after moving. 0 otherwise.
+ */
+int iterNextLL(LinkedListIterator * iterator);
+
+/*
+ * Function: iterPrevLL
+ * ----------------------------
+ * moves the iterator one item towards the head.
+ * 
+ * iterator: the iterator to move.
+ * 
+ * return: 1 if the iterator is on an item after moving. 0 otherwise.
+ */
+int iterPrevLL(LinkedListIterator * iterator);
+
+/*
+ * Function: iterRemoveLL
+ * ----------------------------
+ * removes the item the iterator is positioned on and moves the iterator to
+ *      the item that followed it.
+ * 
+ * iterator: the iterator to perform the remove operation with.
+ * 
+ * return: a pointer of the data of the removed item.  NULL if not valid.
+ */
+void * iterRemoveLL(LinkedListIterator * iterator);
+
+/*
+ * Function: iterInsertBeforeLL
+ * ----------------------------
+ * inserts data in front of the item the iterator is positioned on.  The
+ *      iterator stays on the same item.  If the iterator has run off the
+ *      tail of the list the data is added to the back of the list.
+ * 
+ * iterator: the iterator to perform the insert operation with.
+ * data: the data to be inserted.
+ * 
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int iterInsertBeforeLL(LinkedListIterator * iterator, void * data);
+
 /*
  * Function: destroyLinkedList
  * ----------------------------
@@ -0,0 +1,321 @@
+#include <stdlib.h>
+#ifndef TYPED_LINKED_LIST_H
+#define TYPED_LINKED_LIST_H
+
+#define TLL_SORT_BINS 64
+
+/*
+ * Macro: LL_COMPARE_VALUES
+ * ----------------------------
+ * Compares two values with < and >, returning -1, 0 or 1.  Usable as the
+ *      compare argument of DEFINE_LINKED_LIST for int, long, double and
+ *      other arithmetic types.
+ */
+#define LL_COMPARE_VALUES(a, b) (((a) > (b)) - ((a) < (b)))
+
+/*
+ * Macro: DEFINE_LINKED_LIST
+ * ----------------------------
+ * Defines a doubly linked list that stores values of type T inside its
+ *      nodes, and the functions to use it.  Each item takes one allocation
+ *      instead of a node plus the data it points to, and comparisons call
+ *      compare directly so the compiler can inline them.
+ *
+ * name: the name of the list type.  The node type is name##Node and every
+ *      function is named after the list, e.g.
+ *      DEFINE_LINKED_LIST(IntList, int, LL_COMPARE_VALUES) defines IntList,
+ *      createIntList, addToBackIntList and so on.
+ * T: the type of the values.  Values are copied in and out by assignment.
+ * compare: a function, or function like macro, taking two T and returning
+ *      less than, equal to or greater than zero like compareData.
+ *
+ * The functions mirror those of LinkedList, and the nodes are linked the
+ *      same way, with next towards the head and prev towards the tail:
+ *
+ *      name * create##name(void)
+ *      int addToFront##name(name * list, T value)
+ *      int addToBack##name(name * list, T value)
+ *      int insertAtIndex##name(name * list, T value, int index)
+ *      int removeFromIndex##name(name * list, int index, T * value)
+ *      T * get##name(name * list, int index)
+ *      int search##name(name * list, T value)
+ *      int insertSorted##name(name * list, T value)
+ *      int sort##name(name * list)
+ *      int destroy##name(name * list)
+ *
+ * removeFromIndex copies the removed value into value unless it is NULL
+ *      and returns 1, or 0 if the index is out of bounds.  get returns a
+ *      pointer to the value inside the node, NULL if the index is out of
+ *      bounds.  The rest return what their LinkedList counterparts do.
+ *
+ * note: the list does not free anything the values point to.  Use it in
+ *      one translation unit per name, or in a header included everywhere,
+ *      since every function is static inline.
+ */
+#define DEFINE_LINKED_LIST(name, T, compare) \
+typedef struct name##Node{ \
+    struct name##Node * next; \
+    struct name##Node * prev; \
+    T value; \
+}name##Node; \
+ \
+typedef struct name{ \
+    name##Node * head; \
+    name##Node * tail; \
+    int length; \
+    int sorted; \
+}name; \
+ \
+static inline name * create##name(void){ \
+    name * list = malloc(sizeof(name)); \
+    if(list == NULL){ \
+        return NULL; \
+    } \
+    list->head = NULL; \
+    list->tail = NULL; \
+    list->length = 0; \
+    list->sorted = 1; \
+    return list; \
+} \
+ \
+/* finds the node at index, walking from whichever end is closer. */ \
+static inline name##Node * seek##name(name * list, int index){ \
+    name##Node * node; \
+    if(index < list->length / 2){ \
+        for(node = list->head; index > 0; index--){ \
+            node = node->prev; \
+        } \
+        return node; \
+    } \
+    for(node = list->tail, index = list->length - 1 - index; index > 0; index--){ \
+        node = node->next; \
+    } \
+    return node; \
+} \
+ \
+/* links a new node holding value in front of node, or at the back of the
+   list if node is NULL.  The sorted flag is left to the caller. */ \
+static inline name##Node * linkBefore##name(name * list, name##Node * node, T value){ \
+    name##Node * newNode = malloc(sizeof(name##Node)); \
+    if(newNode == NULL){ \
+        return NULL; \
+    } \
+    newNode->value = value; \
+    newNode->prev = node; \
+    newNode->next = node == NULL ? list->tail : node->next; \
+    if(newNode->next != NULL){ \
+        newNode->next->prev = newNode; \
+    } \
+    else{ \
+        list->head = newNode; \
+    } \
+    if(node != NULL){ \
+        node->next = newNode; \
+    } \
+    else{ \
+        list->tail = newNode; \
+    } \
+    list->length++; \
+    return newNode; \
+} \
+ \
+static inline int addToFront##name(name * list, T value){ \
+    if(list == NULL || linkBefore##name(list, list->head, value) == NULL){ \
+        return 0; \
+    } \
+    if(list->length > 1){ \
+        list->sorted = 0; \
+    } \
+    return 1; \
+} \
+ \
+static inline int addToBack##name(name * list, T value){ \
+    if(list == NULL || linkBefore##name(list, NULL, value) == NULL){ \
+        return 0; \
+    } \
+    if(list->length > 1){ \
+        list->sorted = 0; \
+    } \
+    return 1; \
+} \
+ \
+static inline int insertAtIndex##name(name * list, T value, int index){ \
+    if(list == NULL || index < 0 || index > list->length){ \
+        return 0; \
+    } \
+    name##Node * node = index == list->length ? NULL : seek##name(list, index); \
+    if(linkBefore##name(list, node, value) == NULL){ \
+        return 0; \
+    } \
+    if(list->length > 1){ \
+        list->sorted = 0; \
+    } \
+    return 1; \
+} \
+ \
+static inline int removeFromIndex##name(name * list, int index, T * value){ \
+    if(list == NULL || index < 0 || index >= list->length){ \
+        return 0; \
+    } \
+    name##Node * node = seek##name(list, index); \
+    if(value != NULL){ \
+        *value = node->value; \
+    } \
+    if(node->next != NULL){ \
+        node->next->prev = node->prev; \
+    } \
+    else{ \
+        list->head = node->prev; \
+    } \
+    if(node->prev != NULL){ \
+        node->prev->next = node->next; \
+    } \
+    else{ \
+        list->tail = node->next; \
+    } \
+    free(node); \
+    list->length--; \
+    if(list->length < 2){ \
+        list->sorted = 1; \
+    } \
+    return 1; \
+} \
+ \
+static inline T * get##name(name * list, int index){ \
+    if(list == NULL || index < 0 || index >= list->length){ \
+        return NULL; \
+    } \
+    return &seek##name(list, index)->value; \
+} \
+ \
+/* a sorted list is only scanned up to the first value greater than the
+   one searched for. */ \
+static inline int search##name(name * list, T value){ \
+    if(list == NULL){ \
+        return -1; \
+    } \
+    int index = 0; \
+    for(name##Node * node = list->head; node != NULL; node = node->prev, index++){ \
+        int order = compare(node->value, value); \
+        if(order == 0){ \
+            return index; \
+        } \
+        if(order > 0 && list->sorted){ \
+            return -1; \
+        } \
+    } \
+    return -1; \
+} \
+ \
+static inline int insertSorted##name(name * list, T value){ \
+    if(list == NULL || list->sorted == 0){ \
+        return -1; \
+    } \
+    int index = 0; \
+    name##Node * node = list->head; \
+    while(node != NULL && compare(node->value, value) <= 0){ \
+        node = node->prev; \
+        index++; \
+    } \
+    if(linkBefore##name(list, node, value) == NULL){ \
+        return -1; \
+    } \
+    return index; \
+} \
+ \
+/* merges two sorted lists linked through prev, items of a first. */ \
+static inline name##Node * merge##name(name##Node * a, name##Node * b){ \
+    name##Node head; \
+    name##Node * node = &head; \
+    while(a != NULL && b != NULL){ \
+        if(compare(b->value, a->value) < 0){ \
+            node->prev = b; \
+            b = b->prev; \
+        } \
+        else{ \
+            node->prev = a; \
+            a = a->prev; \
+        } \
+        node = node->prev; \
+    } \
+    node->prev = a != NULL ? a : b; \
+    return head.prev; \
+} \
+ \
+/* detaches the longest sorted run from the front of node, reversing a
+   strictly descending run. */ \
+static inline name##Node * takeRun##name(name##Node * node, name##Node ** rest){ \
+    name##Node * run = node; \
+    name##Node * next = node->prev; \
+    if(next != NULL && compare(next->value, node->value) < 0){ \
+        run->prev = NULL; \
+        while(next != NULL && compare(next->value, run->value) < 0){ \
+            node = next->prev; \
+            next->prev = run; \
+            run = next; \
+            next = node; \
+        } \
+        *rest = next; \
+        return run; \
+    } \
+    while(next != NULL && compare(next->value, node->value) >= 0){ \
+        node = next; \
+        next = next->prev; \
+    } \
+    node->prev = NULL; \
+    *rest = next; \
+    return run; \
+} \
+ \
+/* the same bottom up natural merge sort as sortLL. */ \
+static inline int sort##name(name * list){ \
+    if(list == NULL){ \
+        return 0; \
+    } \
+    name##Node * bins[TLL_SORT_BINS] = {NULL}; \
+    name##Node * first = list->head; \
+    name##Node * run; \
+    int i; \
+    while(first != NULL){ \
+        run = takeRun##name(first, &first); \
+        for(i = 0; i < TLL_SORT_BINS - 1 && bins[i] != NULL; i++){ \
+            run = merge##name(bins[i], run); \
+            bins[i] = NULL; \
+        } \
+        bins[i] = bins[i] == NULL ? run : merge##name(bins[i], run); \
+    } \
+    for(i = 0; i < TLL_SORT_BINS; i++){ \
+        if(bins[i] != NULL){ \
+            first = first == NULL ? bins[i] : merge##name(bins[i], first); \
+        } \
+    } \
+    list->head = first; \
+    list->tail = first; \
+    if(first != NULL){ \
+        first->next = NULL; \
+        while(first->prev != NULL){ \
+            first->prev->next = first; \
+            first = first->prev; \
+        } \
+        list->tail = first; \
+    } \
+    list->sorted = 1; \
+    return 1; \
+} \
+ \
+static inline int destroy##name(name * list){ \
+    if(list == NULL){ \
+        return 0; \
+    } \
+    name##Node * node = list->head; \
+    name##Node * temp; \
+    while(node != NULL){ \
+        temp = node->prev; \
+        free(node); \
+        node = temp; \
+    } \
+    free(list); \
+    return 1; \
+}
+
+#endif
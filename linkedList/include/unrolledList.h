@@ -0,0 +1,190 @@
+#include <stdlib.h>
+#include <stdio.h>
+#ifndef UNROLLED_LIST_H
+#define UNROLLED_LIST_H
+
+#define UL_NODE_CAPACITY 32
+
+/*
+ * Struct: UnrolledListNode
+ * ----------------------------
+ * A node of an unrolled linked list.  Each node holds up to
+ *      UL_NODE_CAPACITY items in an array, so the link overhead is shared by
+ *      many items and neighbouring items share cache lines.
+ *
+ * next: the next node towards the tail of the list
+ * prev: the previous node towards the head of the list
+ * count: the number of items stored in the node
+ * data: the items stored in the node, in list order
+ *
+ * note: the links run the opposite way to LinkedListNode, whose next
+ *      points towards the head and prev towards the tail.  Here next walks
+ *      from head to tail, in index order.
+ */
+typedef struct unrolledListNode{
+    struct unrolledListNode * next;
+    struct unrolledListNode * prev;
+    int count;
+    void * data[UL_NODE_CAPACITY];
+}UnrolledListNode;
+
+/*
+ * Struct: UnrolledList
+ * ----------------------------
+ * Represents an unrolled linked list data structure.
+ *
+ * head: the first node of the list; holds index 0.
+ * tail: the last node of the list.
+ * destroyData: a function pointer that is used to free the data
+ *      stored in the list
+ * compareData: a function pointer that is used to compare two items
+ *      in the list
+ * length: the number of items in the list
+ * sorted: 1=sorted 0=unsorted
+ *
+ */
+typedef struct unrolledList{
+    UnrolledListNode * head;
+    UnrolledListNode * tail;
+    void (*destroyData)(void * data);
+    int (*compareData)(void * a, void * b);
+    int length;
+    int sorted;
+}UnrolledList;
+
+/*
+ * Function: createUnrolledList
+ * ----------------------------
+ * Creates a pointer to an unrolled linked list data structure
+ *
+ * destroyFunc: a function pointer that destroys the data type intended
+ *      to be stored in the list
+ * compareFunc: a function pointer that compares two of the intended data type.
+ *
+ * return: a pointer to the created list.  NULL if failed.
+ */
+UnrolledList * createUnrolledList(void (*destroyFunc)(void * data), int (*compareFunc)(void * a, void * b));
+
+/*
+ * Function: addToFrontUL
+ * ----------------------------
+ * Adds new data to the front of the list
+ *
+ * list: the list to perform the add to front operation on.
+ * data: the data to added to the front of the list.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int addToFrontUL(UnrolledList * list, void * data);
+
+/*
+ * Function: addToBackUL
+ * ----------------------------
+ * Adds new data to the back of the list
+ *
+ * list: the list to perform the add to back operation on.
+ * data: the data to added to the back of the list.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int addToBackUL(UnrolledList * list, void * data);
+
+/*
+ * Function: insertAtIndexUL
+ * ----------------------------
+ * Adds new data to the position of the index
+ *
+ * list: the list to perform the insert operation on.
+ * data: the data to be inserted.
+ * index: the index of where to insert the data
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int insertAtIndexUL(UnrolledList * list, void * data, int index);
+
+/*
+ * Function: removeFromIndexUL
+ * ----------------------------
+ * removes item from position of the index and returns it.
+ *
+ * list: the list to perform the remove operation on.
+ * index: the index of the data to be removed.
+ *
+ * return: a pointer of the data of the removed item.
+ */
+void * removeFromIndexUL(UnrolledList * list, int index);
+
+/*
+ * Function: getUL
+ * ----------------------------
+ * retrieve the item at the given index.
+ *
+ * list: the list to perform the get operation on.
+ * index: the index of the data to be retreive.
+ *
+ * return: a pointer of the data at the given index.
+ */
+void * getUL(UnrolledList * list, int index);
+
+/*
+ * Function: searchUL
+ * ----------------------------
+ * Sequentially checks each item.
+ *
+ * list: the list to perform the search operation on.
+ * data: the item to be found.
+ *
+ * return: the index of the item searched for.  -1 if not found.
+ */
+int searchUL(UnrolledList * list, void * data);
+
+/*
+ * Function: insertSortedUL
+ * ----------------------------
+ * insert an item into a sorted list.
+ *
+ * list: the list to perform the insert operation on.
+ * data: the item to be inserted into the list.
+ *
+ * return: the index the item was inserted to.  -1 if failed.
+ */
+int insertSortedUL(UnrolledList * list, void * data);
+
+/*
+ * Function: sortUL
+ * ----------------------------
+ * Sorts the list using a stable merge sort algorithm.  The items are
+ *      copied into a temporary array, sorted and written back into the
+ *      nodes, so the node structure is unchanged.
+ *
+ * list: the list to perform sort operation on.
+ *
+ * return: 1 if sucessful. 0 if failed.
+ */
+int sortUL(UnrolledList * list);
+
+/*
+ * Function: destroyUnrolledList
+ * ----------------------------
+ * Frees the list and all data stored in the list using
+ *      the destroyData function pointer
+ *
+ * list: the list to perform the destroy operation on.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ *
+ * note: If data is desired to be intact after the destruction of the list
+ *      pass a function pointer that does not destroy the data when initializing
+ *      the list.
+ */
+int destroyUnrolledList(UnrolledList * list);
+
+#endif
@@ -0,0 +1,446 @@
+#include "intrusiveList.h"
+
+/**internal functions**/
+
+/*
+ * Function: linkOfIL
+ * ----------------------------
+ * returns the link embedded in an item.
+ */
+IntrusiveLink * linkOfIL(IntrusiveList * list, void * data){
+    return (IntrusiveLink *)((char *)data + list->offset);
+}
+
+/*
+ * Function: itemOfIL
+ * ----------------------------
+ * returns the item a link is embedded in.
+ */
+void * itemOfIL(IntrusiveList * list, IntrusiveLink * link){
+    return (char *)link - list->offset;
+}
+
+/*
+ * Function: seekIL
+ * ----------------------------
+ * finds the link at an index, walking from whichever end is closer.
+ *
+ * list: the list to walk.
+ * index: the index of the link.  Must be within the bounds of the list.
+ *
+ * return: the link at the given index.
+ */
+IntrusiveLink * seekIL(IntrusiveList * list, int index){
+    IntrusiveLink * link;
+    if(index < list->length / 2){
+        for(link = list->head; index > 0; index--){
+            link = link->prev;
+        }
+        return link;
+    }
+    for(link = list->tail, index = list->length - 1 - index; index > 0; index--){
+        link = link->next;
+    }
+    return link;
+}
+
+/*
+ * Function: linkBeforeIL
+ * ----------------------------
+ * links an item in front of another, or at the back of the list if link is
+ *      NULL.  The sorted flag is left to the caller.
+ *
+ * list: the list to insert into.
+ * link: the link that will follow the new link.  NULL for the back.
+ * newLink: the link of the item being inserted.
+ */
+void linkBeforeIL(IntrusiveList * list, IntrusiveLink * link, IntrusiveLink * newLink){
+    newLink->prev = link;
+    newLink->next = link == NULL ? list->tail : link->next;
+    if(newLink->next != NULL){
+        newLink->next->prev = newLink;
+    }
+    else{
+        list->head = newLink;
+    }
+    if(link != NULL){
+        link->next = newLink;
+    }
+    else{
+        list->tail = newLink;
+    }
+    list->length++;
+}
+
+/*
+ * Function: unlinkIL
+ * ----------------------------
+ * unlinks a link from the list.  The links of the item are cleared.
+ */
+void unlinkIL(IntrusiveList * list, IntrusiveLink * link){
+    if(link->next != NULL){
+        link->next->prev = link->prev;
+    }
+    else{
+        list->head = link->prev;
+    }
+    if(link->prev != NULL){
+        link->prev->next = link->next;
+    }
+    else{
+        list->tail = link->next;
+    }
+    link->next = NULL;
+    link->prev = NULL;
+    list->length--;
+    if(list->length < 2){
+        list->sorted = 1;
+    }
+}
+
+/*
+ * Function: mergeIL
+ * ----------------------------
+ * merges two sorted lists linked through their prev pointers.  Items of a
+ *      are placed before equal items of b so the merge is stable.
+ *
+ * return: the head of the merged list.  Only the prev pointers are set.
+ */
+IntrusiveLink * mergeIL(IntrusiveList * list, IntrusiveLink * a, IntrusiveLink * b){
+    IntrusiveLink head;
+    IntrusiveLink * link = &head;
+    while(a != NULL && b != NULL){
+        if(list->compareData(itemOfIL(list, b), itemOfIL(list, a)) < 0){
+            link->prev = b;
+            b = b->prev;
+        }
+        else{
+            link->prev = a;
+            a = a->prev;
+        }
+        link = link->prev;
+    }
+    link->prev = a != NULL ? a : b;
+    return head.prev;
+}
+
+/*
+ * Function: takeRunIL
+ * ----------------------------
+ * detaches the longest sorted run from the front of an unsorted list.
+ *      A strictly descending run is reversed as it is detached.
+ *
+ * list: the list that contains the comparison function.
+ * link: the head of the unsorted list.
+ * rest: set to the head of the remainder of the list.
+ *
+ * return: the head of the detached run.
+ */
+IntrusiveLink * takeRunIL(IntrusiveList * list, IntrusiveLink * link, IntrusiveLink ** rest){
+    IntrusiveLink * run = link;
+    IntrusiveLink * next = link->prev;
+    if(next != NULL && list->compareData(itemOfIL(list, next), itemOfIL(list, link)) < 0){
+        run->prev = NULL;
+        while(next != NULL && list->compareData(itemOfIL(list, next), itemOfIL(list, run)) < 0){
+            link = next->prev;
+            next->prev = run;
+            run = next;
+            next = link;
+        }
+        *rest = next;
+        return run;
+    }
+    while(next != NULL && list->compareData(itemOfIL(list, next), itemOfIL(list, link)) >= 0){
+        link = next;
+        next = next->prev;
+    }
+    link->prev = NULL;
+    *rest = next;
+    return run;
+}
+
+/**end internal functions**/
+
+/*
+ * Function: createIntrusiveList
+ * ----------------------------
+ * Creates a pointer to an intrusive list data structure
+ *
+ * offset: the offset of the IntrusiveLink within the items, e.g.
+ *      offsetof(Job, link).  An item may be in several lists at once
+ *      through different links.
+ * destroyFunc: a function pointer that destroys the items left in the
+ *      list when it is destroyed.  May be NULL.
+ * compareFunc: a function pointer that compares two items.
+ *
+ * return: a pointer to the created list.  NULL if failed.
+ */
+IntrusiveList * createIntrusiveList(size_t offset, void (*destroyFunc)(void * data), int (*compareFunc)(void * a, void * b)){
+    IntrusiveList * list = malloc(sizeof(IntrusiveList));
+    if(list == NULL){
+        return NULL;
+    }
+    list->head = NULL;
+    list->tail = NULL;
+    list->offset = offset;
+    list->destroyData = destroyFunc;
+    list->compareData = compareFunc;
+    list->length = 0;
+    list->sorted = 1;
+    return list;
+}
+
+/*
+ * Function: addToFrontIL
+ * ----------------------------
+ * Adds an item to the front of the list
+ *
+ * list: the list to perform the add to front operation on.
+ * data: the item to add.  Its link must not be in use by another list.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int addToFrontIL(IntrusiveList * list, void * data){
+    if(list == NULL || data == NULL){
+        return 0;
+    }
+    linkBeforeIL(list, list->head, linkOfIL(list, data));
+    if(list->length > 1){
+        list->sorted = 0;
+    }
+    return 1;
+}
+
+/*
+ * Function: addToBackIL
+ * ----------------------------
+ * Adds an item to the end of the list
+ *
+ * list: the list to perform the add to back operation on.
+ * data: the item to add.  Its link must not be in use by another list.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int addToBackIL(IntrusiveList * list, void * data){
+    if(list == NULL || data == NULL){
+        return 0;
+    }
+    linkBeforeIL(list, NULL, linkOfIL(list, data));
+    if(list->length > 1){
+        list->sorted = 0;
+    }
+    return 1;
+}
+
+/*
+ * Function: insertAtIndexIL
+ * ----------------------------
+ * Adds an item at the given index of the list
+ *
+ * list: the list to perform the insert operation on.
+ * data: the item to add.  Its link must not be in use by another list.
+ * index: the index the item will have.  From 0 to the length of the list.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int insertAtIndexIL(IntrusiveList * list, void * data, int index){
+    if(list == NULL || data == NULL || index < 0 || index > list->length){
+        return 0;
+    }
+    IntrusiveLink * link = index == list->length ? NULL : seekIL(list, index);
+    linkBeforeIL(list, link, linkOfIL(list, data));
+    if(list->length > 1){
+        list->sorted = 0;
+    }
+    return 1;
+}
+
+/*
+ * Function: removeFromIndexIL
+ * ----------------------------
+ * removes the item at the index and returns it.
+ *
+ * list: the list to perform the remove operation on.
+ * index: the index of the item to be removed.
+ *
+ * return: the removed item.  NULL if the index is out of bounds.
+ */
+void * removeFromIndexIL(IntrusiveList * list, int index){
+    if(list == NULL || index < 0 || index >= list->length){
+        return NULL;
+    }
+    IntrusiveLink * link = seekIL(list, index);
+    unlinkIL(list, link);
+    return itemOfIL(list, link);
+}
+
+/*
+ * Function: removeIL
+ * ----------------------------
+ * removes an item from the list in O(1) without searching for it.
+ *
+ * list: the list to perform the remove operation on.
+ * data: the item to remove.  Must be in the list.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int removeIL(IntrusiveList * list, void * data){
+    if(list == NULL || data == NULL || list->length == 0){
+        return 0;
+    }
+    unlinkIL(list, linkOfIL(list, data));
+    return 1;
+}
+
+/*
+ * Function: getIL
+ * ----------------------------
+ * retrieve the item at the given index.
+ *
+ * list: the list to perform the get operation on.
+ * index: the index of the item to retrieve.
+ *
+ * return: the item at the given index.  NULL if out of bounds.
+ */
+void * getIL(IntrusiveList * list, int index){
+    if(list == NULL || index < 0 || index >= list->length){
+        return NULL;
+    }
+    return itemOfIL(list, seekIL(list, index));
+}
+
+/*
+ * Function: searchIL
+ * ----------------------------
+ * Sequentially checks each item.  A sorted list is only checked up to the
+ *      first item greater than the one searched for.
+ *
+ * list: the list to perform the search operation on.
+ * data: the item to be found.
+ *
+ * return: the index of the first item that compares equal.  -1 if not
+ *      found.
+ */
+int searchIL(IntrusiveList * list, void * data){
+    if(list == NULL){
+        return -1;
+    }
+    int (*compare)(void * a, void * b) = list->compareData;
+    size_t offset = list->offset;
+    int sorted = list->sorted;
+    int index = 0;
+    for(IntrusiveLink * link = list->head; link != NULL; link = link->prev, index++){
+        int order = compare((char *)link - offset, data);
+        if(order == 0){
+            return index;
+        }
+        if(sorted && order > 0){
+            return -1;
+        }
+    }
+    return -1;
+}
+
+/*
+ * Function: insertSortedIL
+ * ----------------------------
+ * insert an item into a sorted list, after any equal items.
+ *
+ * list: the list to perform the insert operation on.
+ * data: the item to add.  Its link must not be in use by another list.
+ *
+ * return: the index the item was inserted to.  -1 if failed.
+ */
+int insertSortedIL(IntrusiveList * list, void * data){
+    if(list == NULL || data == NULL || list->sorted == 0){
+        return -1;
+    }
+    int index = 0;
+    IntrusiveLink * link = list->head;
+    while(link != NULL && list->compareData(itemOfIL(list, link), data) <= 0){
+        link = link->prev;
+        index++;
+    }
+    linkBeforeIL(list, link, linkOfIL(list, data));
+    return index;
+}
+
+/*
+ * Function: sortIL
+ * ----------------------------
+ * Sorts the list with the same stable bottom up natural merge sort as
+ *      sortLL, relinking the items without allocating.
+ *
+ * list: the list to perform the sort operation on.
+ *
+ * return: 1 if sucessful. 0 if failed.
+ */
+int sortIL(IntrusiveList * list){
+    if(list == NULL){
+        return 0;
+    }
+    IntrusiveLink * bins[IL_SORT_BINS] = {NULL};
+    IntrusiveLink * first = list->head;
+    IntrusiveLink * run;
+    int i;
+
+    while(first != NULL){
+        run = takeRunIL(list, first, &first);
+        for(i = 0; i < IL_SORT_BINS - 1 && bins[i] != NULL; i++){
+            run = mergeIL(list, bins[i], run);
+            bins[i] = NULL;
+        }
+        bins[i] = bins[i] == NULL ? run : mergeIL(list, bins[i], run);
+    }
+    for(i = 0; i < IL_SORT_BINS; i++){
+        if(bins[i] != NULL){
+            first = first == NULL ? bins[i] : mergeIL(list, bins[i], first);
+        }
+    }
+    list->head = first;
+    list->tail = first;
+    if(first != NULL){
+        first->next = NULL;
+        while(first->prev != NULL){
+            first->prev->next = first;
+            first = first->prev;
+        }
+        list->tail = first;
+    }
+    list->sorted = 1;
+    return 1;
+}
+
+/*
+ * Function: destroyIntrusiveList
+ * ----------------------------
+ * Frees the list, and the items left in it if it has a destroyData.
+ *
+ * list: the list to be destroyed.
+ *
+ * return: 1 if sucessful. 0 if failed.
+ */
+int destroyIntrusiveList(IntrusiveList * list){
+    if(list == NULL){
+        return 0;
+    }
+    IntrusiveLink * link = list->head;
+    IntrusiveLink * temp;
+    while(link != NULL){
+        temp = link->prev;
+        if(list->destroyData != NULL){
+            list->destroyData(itemOfIL(list, link));
+        }
+        link = temp;
+    }
+    free(list);
+    return 1;
+}
@@ -1,15 +1,112 @@
+#include <string.h>
+#include <pthread.h>
 #include "linkedList.h"
 
+/*
+ * Struct: LinkedListSortTask
+ * ----------------------------
+ * A piece of a parallel sort run by one thread.
+ *
+ * list: the list being sorted, for its comparison function.
+ * first: the list of nodes to sort, or the first of two sorted lists to
+ *      merge.  Set to the result once the task has run.
+ * second: the second sorted list to merge.  NULL to sort first.
+ */
+typedef struct linkedListSortTask{
+    LinkedList * list;
+    LinkedListNode * first;
+    LinkedListNode * second;
+}LinkedListSortTask;
+
 /**internal functions**/
 
-LinkedListNode * createLinkedListNode(LinkedListNode * next, LinkedListNode * prev, void * data){
-    LinkedListNode * node = malloc(sizeof(LinkedListNode));
+/*
+ * Function: growNodePool
+ * ----------------------------
+ * allocates a new slab for the pool and pushes all of its nodes onto
+ *      the free list.
+ * 
+ * pool: the node pool to grow.
+ * 
+ * return: 1 if sucessful. 0 if failed.
+ */
+int growNodePool(LinkedListNodePool * pool){
+    LinkedListSlab * slab = malloc(sizeof(LinkedListSlab) + sizeof(LinkedListNode) * pool->slabSize);
+    if(slab == NULL){
+        return 0;
+    }
+    slab->next = pool->slabs;
+    pool->slabs = slab;
+    for(int i = pool->slabSize - 1; i >= 0; i--){
+        slab->nodes[i].prev = pool->freeNodes;
+        pool->freeNodes = &slab->nodes[i];
+    }
+    return 1;
+}
+
+/*
+ * Function: destroyNodePool
+ * ----------------------------
+ * frees every slab owned by the pool and the pool itself.  Nodes taken
+ *      from the pool are released with their slab.
+ * 
+ * pool: the node pool to destroy.
+ */
+void destroyNodePool(LinkedListNodePool * pool){
+    LinkedListSlab * slab = pool->slabs;
+    LinkedListSlab * temp;
+    while(slab != NULL){
+        temp = slab->next;
+        free(slab);
+        slab = temp;
+    }
+    free(pool);
+}
+
+/*
+ * Function: createLinkedListNode
+ * ----------------------------
+ * allocates a node from the list's pool, or with malloc if the list
+ *      is not pooled.
+ * 
+ * return: the new node.  NULL if the allocation failed.
+ */
+LinkedListNode * createLinkedListNode(LinkedList * list, LinkedListNode * next, LinkedListNode * prev, void * data){
+    LinkedListNode * node;
+    LinkedListNodePool * pool = list->pool;
+    if(pool == NULL){
+        node = malloc(sizeof(LinkedListNode));
+    }
+    else{
+        if(pool->freeNodes == NULL && !growNodePool(pool)){
+            return NULL;
+        }
+        node = pool->freeNodes;
+        pool->freeNodes = node->prev;
+    }
+    if(node == NULL){
+        return NULL;
+    }
     node->next = next;
     node->prev = prev;
     node->data = data;
     return node;
 }
 
+/*
+ * Function: freeLinkedListNode
+ * ----------------------------
+ * returns a node to the list's pool, or frees it if the list is not pooled.
+ */
+void freeLinkedListNode(LinkedList * list, LinkedListNode * node){
+    if(list->pool == NULL){
+        free(node);
+        return;
+    }
+    node->prev = list->pool->freeNodes;
+    list->pool->freeNodes = node;
+}
+
 /*
  * Function: merge
  * ----------------------------
@@ -22,364 +119,1929 @@ LinkedListNode * createLinkedListNode(LinkedListNode * next, LinkedListNode * pr
  * b: The second sorted list to be merged
  * 
  * return: a merged sorted list
+ * 
+ * note: only the prev pointers of the merged list are set.  The next
+ *      pointers are restored by relinkLL once sorting is finished.  Items
+ *      of a are placed before equal items of b so the merge is stable.
  */
 LinkedListNode * merge(LinkedList * list, LinkedListNode * a, LinkedListNode * b){
-    LinkedListNode * node = createLinkedListNode(NULL, NULL, NULL);
-    LinkedListNode * head = node;
-    while(a != NULL || b != NULL){
-        if(b == NULL || (a != NULL && list->compareData(a->data, b->data) < 0)){
+    LinkedListNode head;
+    LinkedListNode * node = &head;
+    while(a != NULL && b != NULL){
+        if(list->compareData(b->data, a->data) < 0){
+            node->prev = b;
+            b = b->prev;
+        }
+        else{
             node->prev = a;
             a = a->prev;
         }
+        node = node->prev;
+    }
+    node->prev = a != NULL ? a : b;
+    return head.prev;
+}
+
+/*
+ * Function: takeRun
+ * ----------------------------
+ * detaches the longest sorted run from the front of an unsorted list.
+ *      A strictly descending run is reversed as it is detached.
+ * 
+ * list: The list structure that contains the comparison function.
+ * node: the head of the unsorted list.
+ * rest: set to the head of the remainder of the list.
+ * 
+ * return: the head of the detached run.
+ */
+LinkedListNode * takeRun(LinkedList * list, LinkedListNode * node, LinkedListNode ** rest){
+    LinkedListNode * run = node;
+    LinkedListNode * next = node->prev;
+    if(next != NULL && list->compareData(next->data, node->data) < 0){
+        run->prev = NULL;
+        while(next != NULL && list->compareData(next->data, run->data) < 0){
+            node = next->prev;
+            next->prev = run;
+            run = next;
+            next = node;
+        }
+        *rest = next;
+        return run;
+    }
+    while(next != NULL && list->compareData(next->data, node->data) >= 0){
+        node = next;
+        next = next->prev;
+    }
+    node->prev = NULL;
+    *rest = next;
+    return run;
+}
+
+/*
+ * Function: mergeSort
+ * ----------------------------
+ * sorts a doubly linked list using a bottom up natural mergesort algorithm
+ * 
+ * list: the linked list data structure to be sorted.
+ * first: the head of an unsorted list that must be sorted.
+ * 
+ * return: the list passed in using first after sorting.
+ * 
+ * implementation details: sorted runs are taken from the front of the list
+ *      and merged into bins, where bin i holds the merge of 2^i runs, the
+ *      same way a binary counter carries.  Nothing is allocated and the
+ *      recursion of a top down sort is replaced by the fixed array of bins.
+ *      A list that is already sorted is a single run and takes n - 1
+ *      comparisons.  Only the prev pointers are valid on return.
+ */
+LinkedListNode * mergeSort(LinkedList * list, LinkedListNode * first){
+    LinkedListNode * bins[LL_SORT_BINS] = {NULL};
+    LinkedListNode * run;
+    int i;
+
+    while(first != NULL){
+        run = takeRun(list, first, &first);
+        for(i = 0; i < LL_SORT_BINS - 1 && bins[i] != NULL; i++){
+            run = merge(list, bins[i], run);
+            bins[i] = NULL;
+        }
+        bins[i] = bins[i] == NULL ? run : merge(list, bins[i], run);
+    }
+    for(i = 0; i < LL_SORT_BINS; i++){
+        if(bins[i] != NULL){
+            first = first == NULL ? bins[i] : merge(list, bins[i], first);
+        }
+    }
+    return first;
+}
+
+/*
+ * Function: runSortTask
+ * ----------------------------
+ * sorts or merges the nodes of a LinkedListSortTask.  The start routine of
+ *      the threads of a parallel sort.
+ */
+void * runSortTask(void * argument){
+    LinkedListSortTask * task = argument;
+    if(task->second == NULL){
+        task->first = mergeSort(task->list, task->first);
+    }
+    else{
+        task->first = merge(task->list, task->first, task->second);
+    }
+    return NULL;
+}
+
+/*
+ * Function: runSortTasks
+ * ----------------------------
+ * runs count tasks at the same time, one on the calling thread and the
+ *      rest on new threads, and waits for all of them.  A task whose thread
+ *      could not be started is run on the calling thread instead.
+ */
+void runSortTasks(LinkedListSortTask * tasks, int count){
+    pthread_t threads[LL_MAX_SORT_THREADS];
+    int started[LL_MAX_SORT_THREADS];
+    for(int i = 1; i < count; i++){
+        started[i] = pthread_create(&threads[i], NULL, &runSortTask, &tasks[i]) == 0;
+    }
+    runSortTask(&tasks[0]);
+    for(int i = 1; i < count; i++){
+        if(started[i]){
+            pthread_join(threads[i], NULL);
+        }
         else{
-            node->prev = b;
-            b = b->prev;
+            runSortTask(&tasks[i]);
+        }
+    }
+}
+
+/*
+ * Function: parallelMergeSort
+ * ----------------------------
+ * sorts a list of nodes on several threads.
+ * 
+ * list: the linked list data structure to be sorted.
+ * first: the head of the list.
+ * threads: the number of threads.  At most the length of the list.
+ * 
+ * return: the list passed in using first after sorting.
+ * 
+ * implementation details: the list is cut into one segment per thread,
+ *      each sorted by mergeSort, and the sorted segments are merged in
+ *      pairs, round by round, so equal items keep their order and the last
+ *      round is a single merge of two halves.  Only the prev pointers are
+ *      valid on return.
+ */
+LinkedListNode * parallelMergeSort(LinkedList * list, LinkedListNode * first, int threads){
+    LinkedListSortTask tasks[LL_MAX_SORT_THREADS];
+    LinkedListNode * runs[LL_MAX_SORT_THREADS];
+    LinkedListNode * end;
+    int count = threads;
+    for(int i = 0; i < threads; i++){
+        long size = (long)list->length * (i + 1) / threads - (long)list->length * i / threads;
+        tasks[i].list = list;
+        tasks[i].first = first;
+        tasks[i].second = NULL;
+        for(end = first; size > 1; size--){
+            end = end->prev;
+        }
+        first = end->prev;
+        end->prev = NULL;
+    }
+    runSortTasks(tasks, threads);
+    for(int i = 0; i < threads; i++){
+        runs[i] = tasks[i].first;
+    }
+    while(count > 1){
+        int pairs = count / 2;
+        for(int i = 0; i < pairs; i++){
+            tasks[i].first = runs[2 * i];
+            tasks[i].second = runs[2 * i + 1];
+        }
+        runSortTasks(tasks, pairs);
+        for(int i = 0; i < pairs; i++){
+            runs[i] = tasks[i].first;
+        }
+        if(count % 2 == 1){
+            runs[pairs] = runs[count - 1];
+        }
+        count = pairs + count % 2;
+    }
+    return runs[0];
+}
+
+/*
+ * Function: mergeSortArrayLL
+ * ----------------------------
+ * sorts an array of data with a stable bottom up merge sort.
+ * 
+ * list: The list structure that contains the comparison function.
+ * items: the data to sort.
+ * buffer: room for count items, used while merging.
+ * count: the number of items.
+ * 
+ * return: whichever of items or buffer holds the sorted data.
+ * 
+ * implementation details: blocks of LL_ARRAY_SORT_RUN items are sorted by
+ *      insertion sort, then merged in widths that double each pass, going
+ *      back and forth between items and buffer.  Two blocks that are
+ *      already in order are copied rather than merged.
+ */
+void ** mergeSortArrayLL(LinkedList * list, void ** items, void ** buffer, int count){
+    void ** from = items;
+    void ** to = buffer;
+    void ** temp;
+    for(int start = 0; start < count; start += LL_ARRAY_SORT_RUN){
+        int end = start + LL_ARRAY_SORT_RUN < count ? start + LL_ARRAY_SORT_RUN : count;
+        for(int i = start + 1; i < end; i++){
+            void * data = items[i];
+            int j = i;
+            while(j > start && list->compareData(data, items[j - 1]) < 0){
+                items[j] = items[j - 1];
+                j--;
+            }
+            items[j] = data;
+        }
+    }
+    for(int width = LL_ARRAY_SORT_RUN; width < count; width *= 2){
+        for(int start = 0; start < count; start += 2 * width){
+            int middle = start + width < count ? start + width : count;
+            int end = start + 2 * width < count ? start + 2 * width : count;
+            int a = start;
+            int b = middle;
+            int k = start;
+            if(middle == end || list->compareData(from[middle - 1], from[middle]) <= 0){
+                memcpy(to + start, from + start, sizeof(void *) * (end - start));
+                continue;
+            }
+            while(a < middle && b < end){
+                to[k++] = list->compareData(from[b], from[a]) < 0 ? from[b++] : from[a++];
+            }
+            memcpy(to + k, from + a, sizeof(void *) * (middle - a));
+            memcpy(to + k + middle - a, from + b, sizeof(void *) * (end - b));
         }
+        temp = from;
+        from = to;
+        to = temp;
+    }
+    return from;
+}
+
+/*
+ * Function: relinkLL
+ * ----------------------------
+ * restores the next pointers, head and tail of a list whose nodes are
+ *      only linked through their prev pointers.
+ * 
+ * list: the linked list to relink.
+ * head: the first node of the list.
+ */
+void relinkLL(LinkedList * list, LinkedListNode * head){
+    LinkedListNode * node = head;
+    list->head = head;
+    list->tail = head;
+    if(head == NULL){
+        return;
+    }
+    head->next = NULL;
+    while(node->prev != NULL){
         node->prev->next = node;
-        node = node->prev;        
+        node = node->prev;
     }
-    head->prev->next = NULL;
     list->tail = node;
-    node = head->prev;
-    free(head);
+}
+
+/*
+ * Function: createSkipNode
+ * ----------------------------
+ * allocates a skip index entry with the given number of levels.
+ *
+ * return: the new entry.  NULL if the allocation failed.
+ */
+LinkedListSkipNode * createSkipNode(LinkedListNode * node, int height){
+    LinkedListSkipNode * skipNode = malloc(sizeof(LinkedListSkipNode) + sizeof(struct linkedListSkipLevel) * height);
+    if(skipNode == NULL){
+        return NULL;
+    }
+    skipNode->node = node;
+    for(int i = 0; i < height; i++){
+        skipNode->levels[i].next = NULL;
+        skipNode->levels[i].span = 0;
+    }
+    return skipNode;
+}
+
+/*
+ * Function: randomSkipHeight
+ * ----------------------------
+ * picks the number of levels of a new entry.  0, meaning the node gets no
+ *      entry, with probability 3/4, and otherwise each further level with
+ *      probability 1/4.
+ */
+int randomSkipHeight(LinkedListSkipIndex * skipIndex){
+    int height = 0;
+    do{
+        skipIndex->seed ^= skipIndex->seed << 13;
+        skipIndex->seed ^= skipIndex->seed >> 17;
+        skipIndex->seed ^= skipIndex->seed << 5;
+        height++;
+    }while((skipIndex->seed & 3) == 0 && height < LL_SKIP_MAX_LEVEL + 1);
+    return height - 1;
+}
+
+/*
+ * Function: dropSkipIndexLL
+ * ----------------------------
+ * frees the entries of the list's skip index, if it has one, so it is
+ *      rebuilt the next time it is needed.  Called by every change that
+ *      does not keep the index up to date.
+ */
+void dropSkipIndexLL(LinkedList * list){
+    LinkedListSkipIndex * skipIndex = list->skipIndex;
+    if(skipIndex == NULL || !skipIndex->built){
+        return;
+    }
+    LinkedListSkipNode * skipNode = skipIndex->header->levels[0].next;
+    LinkedListSkipNode * temp;
+    while(skipNode != NULL){
+        temp = skipNode->levels[0].next;
+        free(skipNode);
+        skipNode = temp;
+    }
+    for(int i = 0; i < LL_SKIP_MAX_LEVEL; i++){
+        skipIndex->header->levels[i].next = NULL;
+    }
+    skipIndex->level = 0;
+    skipIndex->built = 0;
+}
+
+/*
+ * Function: buildSkipIndexLL
+ * ----------------------------
+ * builds the entries of the skip index in one pass over a sorted list.
+ *      No comparisons are needed since the list is already in order.
+ *
+ * return: 1 if sucessful. 0 if failed, in which case no index is built.
+ */
+int buildSkipIndexLL(LinkedList * list){
+    LinkedListSkipIndex * skipIndex = list->skipIndex;
+    LinkedListSkipNode * last[LL_SKIP_MAX_LEVEL];
+    int lastIndex[LL_SKIP_MAX_LEVEL];
+    int index = 0;
+    for(int i = 0; i < LL_SKIP_MAX_LEVEL; i++){
+        last[i] = skipIndex->header;
+        lastIndex[i] = -1;
+    }
+    skipIndex->built = 1;
+    for(LinkedListNode * node = list->head; node != NULL; node = node->prev, index++){
+        int height = randomSkipHeight(skipIndex);
+        if(height == 0){
+            continue;
+        }
+        LinkedListSkipNode * skipNode = createSkipNode(node, height);
+        if(skipNode == NULL){
+            dropSkipIndexLL(list);
+            return 0;
+        }
+        for(int i = 0; i < height; i++){
+            last[i]->levels[i].next = skipNode;
+            last[i]->levels[i].span = index - lastIndex[i];
+            last[i] = skipNode;
+            lastIndex[i] = index;
+        }
+        if(height > skipIndex->level){
+            skipIndex->level = height;
+        }
+    }
+    return 1;
+}
+
+/*
+ * Function: searchSkipIndexLL
+ * ----------------------------
+ * finds the first node of a sorted list that is greater than data, or
+ *      greater than or equal to data, by descending the skip index and then
+ *      walking the few nodes between the last entry and the target.
+ *
+ * list: the linked list to search.  Its skip index must be built.
+ * data: the item to search for.
+ * after: 1 to find the first node greater than data.  0 to find the first
+ *      node greater than or equal to data.
+ * update: if not NULL, set to the last entry before the node on each level.
+ * updateIndex: if not NULL, set to the index of each entry in update.
+ * index: set to the index of the node.
+ *
+ * return: the node found.  NULL if there is none, in which case index is
+ *      the length of the list.
+ */
+LinkedListNode * searchSkipIndexLL(LinkedList * list, void * data, int after, LinkedListSkipNode ** update, int * updateIndex, int * index){
+    LinkedListSkipIndex * skipIndex = list->skipIndex;
+    LinkedListSkipNode * skipNode = skipIndex->header;
+    LinkedListNode * node;
+    int position = -1;
+    for(int i = skipIndex->level - 1; i >= 0; i--){
+        while(skipNode->levels[i].next != NULL && list->compareData(skipNode->levels[i].next->node->data, data) < after){
+            position += skipNode->levels[i].span;
+            skipNode = skipNode->levels[i].next;
+        }
+        if(update != NULL){
+            update[i] = skipNode;
+            updateIndex[i] = position;
+        }
+    }
+    node = skipNode == skipIndex->header ? list->head : skipNode->node->prev;
+    position++;
+    while(node != NULL && list->compareData(node->data, data) < after){
+        node = node->prev;
+        position++;
+    }
+    *index = position;
     return node;
 }
 
 /*
- * Function: split
+ * Function: insertSkipNodeLL
+ * ----------------------------
+ * updates the skip index for a node just linked into the list, giving it
+ *      an entry at a random height.
+ *
+ * list: the linked list the node was inserted into.
+ * node: the inserted node.
+ * index: the index of the inserted node.
+ * update, updateIndex: as set by searchSkipIndexLL before the insert.
+ *
+ * return: 1 if sucessful. 0 if failed, in which case the index is dropped.
+ */
+int insertSkipNodeLL(LinkedList * list, LinkedListNode * node, int index, LinkedListSkipNode ** update, int * updateIndex){
+    LinkedListSkipIndex * skipIndex = list->skipIndex;
+    int height = randomSkipHeight(skipIndex);
+    LinkedListSkipNode * skipNode = NULL;
+    if(height > 0 && (skipNode = createSkipNode(node, height)) == NULL){
+        dropSkipIndexLL(list);
+        return 0;
+    }
+    for(int i = skipIndex->level; i < height; i++){
+        update[i] = skipIndex->header;
+        updateIndex[i] = -1;
+    }
+    if(height > skipIndex->level){
+        skipIndex->level = height;
+    }
+    for(int i = 0; i < skipIndex->level; i++){
+        struct linkedListSkipLevel * level = &update[i]->levels[i];
+        if(i < height){
+            skipNode->levels[i].next = level->next;
+            if(level->next != NULL){
+                skipNode->levels[i].span = updateIndex[i] + level->span + 1 - index;
+            }
+            level->next = skipNode;
+            level->span = index - updateIndex[i];
+        }
+        else if(level->next != NULL){
+            level->span++;
+        }
+    }
+    return 1;
+}
+
+/*
+ * Function: removeSkipNodeLL
+ * ----------------------------
+ * updates the skip index for a node about to be unlinked from the list,
+ *      freeing its entry if it has one.  The entries before the node are
+ *      found by index rather than by comparison, so equal items are told
+ *      apart.
+ *
+ * list: the linked list the node is removed from.
+ * node: the node being removed.
+ * index: the index of the node.
+ */
+void removeSkipNodeLL(LinkedList * list, LinkedListNode * node, int index){
+    LinkedListSkipIndex * skipIndex = list->skipIndex;
+    LinkedListSkipNode * skipNode = skipIndex->header;
+    LinkedListSkipNode * removed = NULL;
+    int position = -1;
+    for(int i = skipIndex->level - 1; i >= 0; i--){
+        struct linkedListSkipLevel * level = &skipNode->levels[i];
+        while(level->next != NULL && position + level->span < index){
+            position += level->span;
+            skipNode = level->next;
+            level = &skipNode->levels[i];
+        }
+        if(level->next != NULL && level->next->node == node){
+            removed = level->next;
+            level->span += removed->levels[i].span - 1;
+            level->next = removed->levels[i].next;
+        }
+        else if(level->next != NULL){
+            level->span--;
+        }
+    }
+    free(removed);
+    while(skipIndex->level > 0 && skipIndex->header->levels[skipIndex->level - 1].next == NULL){
+        skipIndex->level--;
+    }
+}
+
+/*
+ * Function: putHashEntry
+ * ----------------------------
+ * stores a node in the first empty slot of its probe sequence.  The table
+ *      must have an empty slot.
+ */
+void putHashEntry(LinkedListHashIndex * hashIndex, LinkedListNode * node, unsigned long hash, long label){
+    int mask = hashIndex->capacity - 1;
+    int slot = hash & mask;
+    while(hashIndex->entries[slot].node != NULL){
+        slot = (slot + 1) & mask;
+    }
+    hashIndex->entries[slot].node = node;
+    hashIndex->entries[slot].hash = hash;
+    hashIndex->entries[slot].label = label;
+}
+
+/*
+ * Function: reserveHashIndexLL
+ * ----------------------------
+ * makes room in the list's hash index, if it has one, for count more nodes
+ *      so they can be indexed without failing once they are linked.  The
+ *      table doubles whenever it would become more than half full.
+ *
+ * return: 1 if sucessful. 0 if failed.
+ */
+int reserveHashIndexLL(LinkedList * list, int count){
+    LinkedListHashIndex * hashIndex = list->hashIndex;
+    if(hashIndex == NULL || (hashIndex->count + count) * 2 <= hashIndex->capacity){
+        return 1;
+    }
+    LinkedListHashEntry * old = hashIndex->entries;
+    int oldCapacity = hashIndex->capacity;
+    int capacity = oldCapacity * 2;
+    while((hashIndex->count + count) * 2 > capacity){
+        capacity *= 2;
+    }
+    LinkedListHashEntry * entries = calloc(capacity, sizeof(LinkedListHashEntry));
+    if(entries == NULL){
+        return 0;
+    }
+    hashIndex->entries = entries;
+    hashIndex->capacity = capacity;
+    for(int i = 0; i < oldCapacity; i++){
+        if(old[i].node != NULL){
+            putHashEntry(hashIndex, old[i].node, old[i].hash, old[i].label);
+        }
+    }
+    free(old);
+    return 1;
+}
+
+/*
+ * Function: findHashSlotLL
+ * ----------------------------
+ * returns the slot of the hash index holding the given node.  The node
+ *      must be in the index.
+ */
+int findHashSlotLL(LinkedList * list, LinkedListNode * node){
+    LinkedListHashIndex * hashIndex = list->hashIndex;
+    int mask = hashIndex->capacity - 1;
+    int slot = list->hashData(node->data) & mask;
+    while(hashIndex->entries[slot].node != node){
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+/*
+ * Function: addHashNodeLL
+ * ----------------------------
+ * adds a node just linked into the list to the list's hash index, if it has
+ *      one.  Room must have been made with reserveHashIndexLL.
+ *
+ * list: the linked list the node was linked into.
+ * node: the new node.
+ * index: the index of the new node.
+ */
+void addHashNodeLL(LinkedList * list, LinkedListNode * node, int index){
+    LinkedListHashIndex * hashIndex = list->hashIndex;
+    long label = 0;
+    if(hashIndex == NULL){
+        return;
+    }
+    if(hashIndex->count == 0){
+        hashIndex->firstLabel = 0;
+        hashIndex->lastLabel = 0;
+        hashIndex->labelled = 1;
+    }
+    else if(index == 0){
+        label = --hashIndex->firstLabel;
+    }
+    else if(index == list->length - 1){
+        label = ++hashIndex->lastLabel;
+    }
+    else{
+        hashIndex->labelled = 0;
+    }
+    putHashEntry(hashIndex, node, list->hashData(node->data), label);
+    hashIndex->count++;
+}
+
+/*
+ * Function: eraseHashEntryLL
+ * ----------------------------
+ * removes a node from the list's hash index.  The slots after it in its
+ *      probe sequence are shifted back so no tombstones are needed.  The
+ *      labels are left to the caller.
+ */
+void eraseHashEntryLL(LinkedList * list, LinkedListNode * node){
+    LinkedListHashIndex * hashIndex = list->hashIndex;
+    LinkedListHashEntry * entries = hashIndex->entries;
+    int mask = hashIndex->capacity - 1;
+    int slot = findHashSlotLL(list, node);
+    int next = slot;
+    while(entries[next = (next + 1) & mask].node != NULL){
+        int home = entries[next].hash & mask;
+        if(((next - home) & mask) >= ((next - slot) & mask)){
+            entries[slot] = entries[next];
+            slot = next;
+        }
+    }
+    entries[slot].node = NULL;
+    hashIndex->count--;
+}
+
+/*
+ * Function: removeHashNodeLL
+ * ----------------------------
+ * removes a node about to be unlinked from the list's hash index.
+ *
+ * list: the linked list the node is removed from.
+ * node: the node being removed.
+ * index: the index of the node.
+ */
+void removeHashNodeLL(LinkedList * list, LinkedListNode * node, int index){
+    LinkedListHashIndex * hashIndex = list->hashIndex;
+    eraseHashEntryLL(list, node);
+    if(index == 0){
+        hashIndex->firstLabel++;
+    }
+    else if(index == list->length - 1){
+        hashIndex->lastLabel--;
+    }
+    else{
+        hashIndex->labelled = 0;
+    }
+}
+
+/*
+ * Function: relabelHashIndexLL
+ * ----------------------------
+ * renumbers the labels of the hash index from 0 at the head.
+ */
+void relabelHashIndexLL(LinkedList * list){
+    LinkedListHashIndex * hashIndex = list->hashIndex;
+    long label = 0;
+    for(LinkedListNode * node = list->head; node != NULL; node = node->prev){
+        hashIndex->entries[findHashSlotLL(list, node)].label = label++;
+    }
+    hashIndex->firstLabel = 0;
+    hashIndex->lastLabel = label - 1;
+    hashIndex->labelled = 1;
+}
+
+/*
+ * Function: searchHashIndexLL
+ * ----------------------------
+ * looks up the first node of the list holding an item equal to data.
+ *
+ * list: the linked list to search.  It must have a hash index.
+ * data: the item to look for.
+ * index: if not NULL, set to the index of the node.
+ *
+ * return: the node found.  NULL if there is none.
+ */
+LinkedListNode * searchHashIndexLL(LinkedList * list, void * data, int * index){
+    LinkedListHashIndex * hashIndex = list->hashIndex;
+    LinkedListHashEntry * found = NULL;
+    unsigned long hash = list->hashData(data);
+    int mask = hashIndex->capacity - 1;
+    if(index != NULL && !hashIndex->labelled){
+        relabelHashIndexLL(list);
+    }
+    for(int slot = hash & mask; hashIndex->entries[slot].node != NULL; slot = (slot + 1) & mask){
+        LinkedListHashEntry * entry = &hashIndex->entries[slot];
+        if(entry->hash == hash && (found == NULL || entry->label < found->label) && list->compareData(data, entry->node->data) == 0){
+            found = entry;
+            if(index == NULL){
+                break;
+            }
+        }
+    }
+    if(found == NULL){
+        return NULL;
+    }
+    if(index != NULL){
+        *index = found->label - hashIndex->firstLabel;
+    }
+    return found->node;
+}
+
+/*
+ * Function: seekLL
+ * ----------------------------
+ * finds the node at the given index starting from whichever of the head,
+ *      the tail or the cursor is closest, and moves the cursor to it.
+ * 
+ * list: the linked list to search.
+ * index: the index of the node.  Must be within the bounds of the list.
+ * 
+ * return: the node at the given index.
+ */
+LinkedListNode * seekLL(LinkedList * list, int index){
+    LinkedListNode * node = list->head;
+    int position = 0;
+    int distance = index;
+    if(list->length - 1 - index < distance){
+        node = list->tail;
+        position = list->length - 1;
+        distance = list->length - 1 - index;
+    }
+    if(list->cursor != NULL && abs(index - list->cursorIndex) < distance){
+        node = list->cursor;
+        position = list->cursorIndex;
+    }
+    while(position < index){
+        node = node->prev;
+        position++;
+    }
+    while(position > index){
+        node = node->next;
+        position--;
+    }
+    list->cursor = node;
+    list->cursorIndex = index;
+    return node;
+}
+
+/*
+ * Function: linkBeforeLL
+ * ----------------------------
+ * creates a node holding data and links it in front of node, and moves
+ *      the cursor to the new node.  The sorted flag is left to the caller.
+ * 
+ * list: the linked list to insert into.
+ * node: the node that will follow the new node.
+ * data: the data to be inserted.
+ * index: the index the new node will have.
+ * 
+ * return: the new node.  NULL if failed.
+ */
+LinkedListNode * linkBeforeLL(LinkedList * list, LinkedListNode * node, void * data, int index){
+    if(!reserveHashIndexLL(list, 1)){
+        return NULL;
+    }
+    LinkedListNode * newNode = createLinkedListNode(list, node->next, node, data);
+    if(newNode == NULL){
+        return NULL;
+    }
+    if(node->next == NULL){
+        list->head = newNode;
+    }
+    else{
+        node->next->prev = newNode;
+    }
+    node->next = newNode;
+    list->cursor = newNode;
+    list->cursorIndex = index;
+    list->length++;
+    addHashNodeLL(list, newNode, index);
+    return newNode;
+}
+
+/*
+ * Function: unlinkLL
+ * ----------------------------
+ * unlinks a node from the list without freeing it and moves the cursor
+ *      to a neighbour of the node.
+ * 
+ * list: the linked list to remove from.
+ * node: the node to unlink.
+ * index: the index of the node.
+ */
+void unlinkLL(LinkedList * list, LinkedListNode * node, int index){
+    if(list->skipIndex != NULL && list->skipIndex->built){
+        removeSkipNodeLL(list, node, index);
+    }
+    if(list->hashIndex != NULL){
+        removeHashNodeLL(list, node, index);
+    }
+    if(node->next != NULL){
+        node->next->prev = node->prev;
+    }
+    else{
+        list->head = node->prev;
+
+    }
+    if(node->prev != NULL){
+        node->prev->next = node->next;
+        list->cursor = node->prev;
+        list->cursorIndex = index;
+    }
+    else{
+        list->tail = node->next;
+        list->cursor = node->next;
+        list->cursorIndex = index - 1;
+    }
+    list->length--;
+    if(list->length < 2){
+        list->sorted = 1;
+    }
+}
+
+/*
+ * Function: linkBackLL
+ * ----------------------------
+ * creates a node holding data and links it at the back of the list.  The
+ *      sorted flag is left to the caller.
+ * 
+ * return: the new node.  NULL if failed.
+ */
+LinkedListNode * linkBackLL(LinkedList * list, void * data){
+    if(!reserveHashIndexLL(list, 1)){
+        return NULL;
+    }
+    LinkedListNode * node = createLinkedListNode(list, list->tail, NULL, data);
+    if(node == NULL){
+        return NULL;
+    }
+    if(list->tail != NULL){
+        list->tail->prev = node;
+    }
+    list->tail = node;
+    if(list->head == NULL){
+        list->head = node;
+    }
+    list->length++;
+    addHashNodeLL(list, node, list->length - 1);
+    return node;
+}
+
+/*
+ * Function: detachRangeLL
+ * ----------------------------
+ * unlinks count nodes starting at index from the list without freeing them.
+ *      The nodes stay linked to each other, with the next pointer of the
+ *      first and the prev pointer of the last set to NULL.
+ * 
+ * list: the linked list to remove from.
+ * index: the index of the first node.
+ * count: the number of nodes.  At least one.
+ * last: set to the last node of the range.
+ * 
+ * return: the first node of the range.
+ */
+LinkedListNode * detachRangeLL(LinkedList * list, int index, int count, LinkedListNode ** last){
+    LinkedListHashIndex * hashIndex = list->hashIndex;
+    LinkedListNode * first = index == 0 ? list->head : seekLL(list, index);
+    *last = index + count == list->length ? list->tail : seekLL(list, index + count - 1);
+    dropSkipIndexLL(list);
+    if(hashIndex != NULL && count == list->length){
+        memset(hashIndex->entries, 0, sizeof(LinkedListHashEntry) * hashIndex->capacity);
+        hashIndex->count = 0;
+    }
+    else if(hashIndex != NULL){
+        for(LinkedListNode * node = first; node != (*last)->prev; node = node->prev){
+            eraseHashEntryLL(list, node);
+        }
+        if(index == 0){
+            hashIndex->firstLabel += count;
+        }
+        else if(index + count == list->length){
+            hashIndex->lastLabel -= count;
+        }
+        else{
+            hashIndex->labelled = 0;
+        }
+    }
+    if(first->next != NULL){
+        first->next->prev = (*last)->prev;
+    }
+    else{
+        list->head = (*last)->prev;
+    }
+    if((*last)->prev != NULL){
+        (*last)->prev->next = first->next;
+    }
+    else{
+        list->tail = first->next;
+    }
+    first->next = NULL;
+    (*last)->prev = NULL;
+    list->length -= count;
+    list->cursor = NULL;
+    if(list->length < 2){
+        list->sorted = 1;
+    }
+    return first;
+}
+
+/*
+ * Function: attachRangeLL
+ * ----------------------------
+ * links a range of nodes, as returned by detachRangeLL, in front of the node
+ *      at index, or at the back of the list if index is its length.  Room
+ *      for the nodes must have been made with reserveHashIndexLL.
+ * 
+ * list: the linked list to insert into.
+ * index: the index the first node of the range will have.
+ * first: the first node of the range.
+ * last: the last node of the range.
+ * count: the number of nodes in the range.
+ * sorted: 1 if the range is in order.  The list stays sorted if it was
+ *      and the range is in order with the nodes on either side of it.
+ */
+void attachRangeLL(LinkedList * list, int index, LinkedListNode * first, LinkedListNode * last, int count, int sorted){
+    LinkedListHashIndex * hashIndex = list->hashIndex;
+    LinkedListNode * after = index == list->length ? NULL : seekLL(list, index);
+    LinkedListNode * before = after == NULL ? list->tail : after->next;
+    if(sorted && before != NULL){
+        sorted = list->sorted && list->compareData(before->data, first->data) <= 0;
+    }
+    if(sorted && after != NULL){
+        sorted = list->sorted && list->compareData(last->data, after->data) <= 0;
+    }
+    dropSkipIndexLL(list);
+    first->next = before;
+    last->prev = after;
+    if(before != NULL){
+        before->prev = first;
+    }
+    else{
+        list->head = first;
+    }
+    if(after != NULL){
+        after->next = last;
+    }
+    else{
+        list->tail = last;
+    }
+    if(hashIndex != NULL){
+        long label = 0;
+        if(hashIndex->count == 0){
+            hashIndex->firstLabel = 0;
+            hashIndex->lastLabel = count - 1;
+            hashIndex->labelled = 1;
+        }
+        else if(after == NULL){
+            label = hashIndex->lastLabel + 1;
+            hashIndex->lastLabel += count;
+        }
+        else if(before == NULL){
+            hashIndex->firstLabel -= count;
+            label = hashIndex->firstLabel;
+        }
+        else{
+            hashIndex->labelled = 0;
+        }
+        for(LinkedListNode * node = first; node != after; node = node->prev){
+            putHashEntry(hashIndex, node, list->hashData(node->data), label++);
+        }
+        hashIndex->count += count;
+    }
+    list->length += count;
+    list->cursor = NULL;
+    list->sorted = sorted;
+}
+
+/*
+ * Function: copyRangeLL
+ * ----------------------------
+ * allocates nodes from the list for the data of count nodes starting at
+ *      first, linked the same way as a range returned by detachRangeLL.
+ *      Used when items move between lists that do not allocate their nodes
+ *      from the same place.
+ * 
+ * return: the first node of the copy.  NULL if an allocation failed, in
+ *      which case nothing is left allocated.
+ */
+LinkedListNode * copyRangeLL(LinkedList * list, LinkedListNode * first, int count, LinkedListNode ** last){
+    LinkedListNode * copy = NULL;
+    LinkedListNode * node;
+    *last = NULL;
+    for(int i = 0; i < count; i++){
+        if((node = createLinkedListNode(list, *last, NULL, first->data)) == NULL){
+            while(*last != NULL){
+                node = (*last)->next;
+                freeLinkedListNode(list, *last);
+                *last = node;
+            }
+            return NULL;
+        }
+        if(*last != NULL){
+            (*last)->prev = node;
+        }
+        else{
+            copy = node;
+        }
+        *last = node;
+        first = first->prev;
+    }
+    return copy;
+}
+
+/*
+ * Function: takeRangeLL
+ * ----------------------------
+ * detaches count items starting at first from src as a range of nodes for
+ *      dest to link in, and makes room for them in the hash index of dest.
+ *      The nodes themselves are taken when both lists allocate from the
+ *      same place, otherwise dest allocates new nodes for the items and the
+ *      old ones are freed.
+ * 
+ * last: set to the last node of the range.
+ * 
+ * return: the first node of the range.  NULL if failed, in which case
+ *      neither list changes.
+ */
+LinkedListNode * takeRangeLL(LinkedList * dest, LinkedList * src, int first, int count, LinkedListNode ** last){
+    LinkedListNode * copy = NULL;
+    LinkedListNode * copyLast;
+    LinkedListNode * temp;
+    if(!reserveHashIndexLL(dest, count)){
+        return NULL;
+    }
+    if(dest->pool != src->pool && (copy = copyRangeLL(dest, seekLL(src, first), count, &copyLast)) == NULL){
+        return NULL;
+    }
+    LinkedListNode * node = detachRangeLL(src, first, count, last);
+    if(copy == NULL){
+        return node;
+    }
+    while(node != NULL){
+        temp = node->prev;
+        freeLinkedListNode(src, node);
+        node = temp;
+    }
+    *last = copyLast;
+    return copy;
+}
+
+/*
+ * Function: moveRangeLL
+ * ----------------------------
+ * moves count items starting at first in src in front of index in dest.
+ * 
+ * return: 1 if sucessful. 0 if failed, in which case neither list changes.
+ */
+int moveRangeLL(LinkedList * dest, int index, LinkedList * src, int first, int count){
+    LinkedListNode * last;
+    int sorted = src->sorted || count < 2;
+    if(count == 0){
+        return 1;
+    }
+    LinkedListNode * node = takeRangeLL(dest, src, first, count, &last);
+    if(node == NULL){
+        return 0;
+    }
+    attachRangeLL(dest, index, node, last, count, sorted);
+    return 1;
+}
+
+/**end internal functions**/
+
+/*
+ * Function: createLinkedList
+ * ----------------------------
+ * Creates a pointer to a linked list data structures
+ * 
+ * destroyFunc: a function pointer that destroys the data type intended
+ *      to be stored in the stack
+ * compareFunc: a function pointer that compares two of the intended data type.
+ * 
+ * return: a pointer to the created linked list
+ */
+LinkedList * createLinkedList(void (*destroyFunc)(void * data), int (*compareFunc)(void * a, void * b)){
+    LinkedList * list = malloc(sizeof(LinkedList));
+    list->destroyData = destroyFunc;
+    list->compareData = compareFunc;
+    list->hashData = NULL;
+    list->head = NULL;
+    list->tail = NULL;
+    list->length = 0;
+    list->sorted = 1;
+    list->pool = NULL;
+    list->cursor = NULL;
+    list->cursorIndex = 0;
+    list->skipIndex = NULL;
+    list->hashIndex = NULL;
+    list->sortThreads = 1;
+    list->sortCutoff = LL_DEFAULT_SORT_CUTOFF;
+    return list;
+}
+
+/*
+ * Function: createPooledLinkedList
+ * ----------------------------
+ * Creates a pointer to a linked list data structure that allocates its
+ *      nodes from a node pool instead of calling malloc for every node.
+ * 
+ * destroyFunc: a function pointer that destroys the data type intended
+ *      to be stored in the stack
+ * compareFunc: a function pointer that compares two of the intended data type.
+ * slabSize: the number of nodes allocated at once when the pool runs out
+ *      of free nodes.  A value less than one uses LL_DEFAULT_SLAB_SIZE.
+ * 
+ * return: a pointer to the created linked list.  NULL if failed.
+ */
+LinkedList * createPooledLinkedList(void (*destroyFunc)(void * data), int (*compareFunc)(void * a, void * b), int slabSize){
+    LinkedList * list = createLinkedList(destroyFunc, compareFunc);
+    if(list == NULL){
+        return NULL;
+    }
+    LinkedListNodePool * pool = malloc(sizeof(LinkedListNodePool));
+    if(pool == NULL){
+        free(list);
+        return NULL;
+    }
+    pool->slabs = NULL;
+    pool->freeNodes = NULL;
+    pool->slabSize = slabSize < 1 ? LL_DEFAULT_SLAB_SIZE : slabSize;
+    pool->users = 1;
+    list->pool = pool;
+    return list;
+}
+
+/*
+ * Function: addToFrontLL
+ * ----------------------------
+ * Adds new data to the front of the list
+ * 
+ * list: the linked list to perform the add to front operation on.
+ * data: the data to added to the front of the list.
+ * 
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int addToFrontLL(LinkedList * list, void * data){
+    if(list == NULL || !reserveHashIndexLL(list, 1)){
+        return 0;
+    }
+    LinkedListNode * node = createLinkedListNode(list, NULL, list->head, data);
+    if(node == NULL){
+        return 0;
+    }
+    dropSkipIndexLL(list);
+    if(list->head != NULL){
+        list->head->next = node;
+    }
+    list->head = node;
+    if(list->tail == NULL){
+        list->tail = node;
+    }
+    list->cursorIndex++;
+    list->length++;
+    addHashNodeLL(list, node, 0);
+    if(list->length > 1){
+        list->sorted = 0;
+    }
+    return 1;
+}
+
+/*
+ * Function: addToBackLL
+ * ----------------------------
+ * Adds new data to the back of the list
+ * 
+ * list: the linked list to perform the add to back operation on.
+ * data: the data to added to the back of the list.
+ * 
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int addToBackLL(LinkedList * list, void * data){
+    if(list == NULL){
+        return 0;
+    }
+    if(linkBackLL(list, data) == NULL){
+        return 0;
+    }
+    dropSkipIndexLL(list);
+    if(list->length > 1){
+        list->sorted = 0;
+    }
+    return 1;
+}
+
+/*
+ * Function: insertAtIndexLL
+ * ----------------------------
+ * Adds new data to the position of the index
+ * 
+ * list: the linked list to perform the insert operation on.
+ * data: the data to be inserted.
+ * index: the index of where to insert the data
+ * 
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int insertAtIndexLL(LinkedList * list, void * data, int index){
+    if(list == NULL){
+        return 0;
+    }
+    if(index > list->length || index < 0){
+        return 0;
+    }
+    LinkedListNode * node;
+    if(index == 0  || list->head == NULL){
+        return addToFrontLL(list, data);
+    }
+    else if(index == list->length){
+        return addToBackLL(list, data);
+    }
+    node = seekLL(list, index);
+    if(linkBeforeLL(list, node, data, index) == NULL){
+        return 0;
+    }
+    dropSkipIndexLL(list);
+    list->sorted = 0;
+    return 1;
+}
+
+/*
+ * Function: removeFromIndexLL
+ * ----------------------------
+ * removes item from position of the index and returns it.
+ * 
+ * list: the linked list to perform the remove operation on.
+ * index: the index of the data to be removed.
+ * 
+ * return: a pointer of the data of the removed item.
+ */
+void * removeFromIndexLL(LinkedList * list, int index){
+    if(list == NULL || index < 0 || index >= list->length){
+        return NULL;
+    }
+    LinkedListNode * node = seekLL(list, index);
+    void * data = node->data;
+    unlinkLL(list, node, index);
+    freeLinkedListNode(list, node);
+    return data;
+}
+
+/*
+ * Function: getLL
+ * ----------------------------
+ * retrieve the item at the given index.
+ * 
+ * list: the linked list to perform the get operation on.
+ * index: the index of the data to be retreive.
+ * 
+ * return: a pointer of the data at the given index.
+ */
+void * getLL(LinkedList * list, int index){
+    if(list == NULL || index < 0 || index > list->length - 1 || list->head == NULL){
+        return NULL;
+    }
+    return seekLL(list, index)->data;
+}
+
+/*
+ * Function: searchLL
+ * ----------------------------
+ * Sequentially checks each item.
+ * 
+ * list: the linked list to perform the search operation on.
+ * data: the item to be found.
+ * 
+ * return: the index of the item searched for.  -1 if not found.
+ */
+int searchLL(LinkedList * list, void * data){
+    if(list == NULL){
+        return -1;
+    }
+    int count = 0;
+    LinkedListNode * node = list->head;
+    if(list->hashIndex != NULL){
+        if((node = searchHashIndexLL(list, data, &count)) == NULL){
+            return -1;
+        }
+        list->cursor = node;
+        list->cursorIndex = count;
+        return count;
+    }
+    if(list->sorted && list->skipIndex != NULL && (list->skipIndex->built || buildSkipIndexLL(list))){
+        node = searchSkipIndexLL(list, data, 0, NULL, NULL, &count);
+        if(node == NULL || list->compareData(data, node->data) != 0){
+            return -1;
+        }
+        list->cursor = node;
+        list->cursorIndex = count;
+        return count;
+    }
+    while(node != NULL){
+        if(list->compareData(data, node->data) == 0){
+            list->cursor = node;
+            list->cursorIndex = count;
+            return count; 
+        }
+        node = node->prev;
+        count++;
+    }
+    return -1;
+}
+
+/*
+ * Function: insertSortedLL
+ * ----------------------------
+ * insert an item into a sorted list.
+ * 
+ * list: the linked list to perform the insert operation on.
+ * data: the item to be inserted into the list.
+ * 
+ * return: the index the item was inserted to.  -1 if failed.
+ */
+int insertSortedLL(LinkedList * list, void * data){
+    if(list == NULL || list->sorted == 0){
+        return -1;
+    }
+    LinkedListNode * node = list->head;
+    int index = 0;
+    if(list->skipIndex != NULL && (list->skipIndex->built || buildSkipIndexLL(list))){
+        LinkedListSkipNode * update[LL_SKIP_MAX_LEVEL];
+        int updateIndex[LL_SKIP_MAX_LEVEL];
+        node = searchSkipIndexLL(list, data, 1, update, updateIndex, &index);
+        node = node == NULL ? linkBackLL(list, data) : linkBeforeLL(list, node, data, index);
+        if(node == NULL){
+            return -1;
+        }
+        insertSkipNodeLL(list, node, index, update, updateIndex);
+        return index;
+    }
+    while(node != NULL){
+        if(list->compareData(node->data, data) > 0){
+            if(linkBeforeLL(list, node, data, index) == NULL){
+                return -1;
+            }
+            return index;
+        }
+        index++;
+        node = node->prev;
+    }
+    if(linkBackLL(list, data) == NULL){
+        return -1;
+    }
+    return index;
+}
+
+/*
+ * Function: sortLL
+ * ----------------------------
+ * Sorts the linked list using a stable bottom up merge sort algorithm.
+ *      Runs that are already sorted are merged as a whole, so a sorted or
+ *      reverse sorted list is handled in linear time.  Lists of at least
+ *      sortCutoff items are sorted on sortThreads threads, see
+ *      setSortThreadsLL.
+ * 
+ * list: the linked list to perform sort operation on.
+ * 
+ * return: 1 if sucessful. 0 if failed.
+ */
+int sortLL(LinkedList * list){
+    if(list == NULL){
+        return 0;
+    }
+    dropSkipIndexLL(list);
+    if(list->hashIndex != NULL){
+        list->hashIndex->labelled = 0;
+    }
+    if(list->sortThreads > 1 && list->length >= list->sortCutoff && list->length >= list->sortThreads){
+        relinkLL(list, parallelMergeSort(list, list->head, list->sortThreads));
+    }
+    else{
+        relinkLL(list, mergeSort(list, list->head));
+    }
+    list->cursor = NULL;
+    list->sorted = 1;
+    return 1;    
+}
+
+/*
+ * Function: setSortThreadsLL
+ * ----------------------------
+ * Sets the number of threads sortLL uses.  A list of at least cutoff items
+ *      is cut into one segment per thread and the segments are sorted at
+ *      the same time.  The sorted segments are then merged in pairs, each
+ *      round of pairs also at the same time, until one list is left.
+ *      Shorter lists are sorted on the calling thread.
+ * 
+ * list: the linked list to configure.
+ * threads: the number of threads, from 1, which always sorts on the
+ *      calling thread, up to LL_MAX_SORT_THREADS.
+ * cutoff: the smallest list sorted on more than one thread.  A value less
+ *      than one uses LL_DEFAULT_SORT_CUTOFF.
+ * 
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ * 
+ * note: compareData is called from several threads at once and must be
+ *      safe to call that way.
+ */
+int setSortThreadsLL(LinkedList * list, int threads, int cutoff){
+    if(list == NULL || threads < 1 || threads > LL_MAX_SORT_THREADS){
+        return 0;
+    }
+    list->sortThreads = threads;
+    list->sortCutoff = cutoff < 1 ? LL_DEFAULT_SORT_CUTOFF : cutoff;
+    return 1;
+}
+
+/*
+ * Function: arraySortLL
+ * ----------------------------
+ * Sorts the linked list by copying its data into an array, sorting the
+ *      array with a stable merge sort and writing the data back into the
+ *      nodes in order.  The nodes are not relinked, so they are walked in
+ *      memory order twice instead of being chased by every merge, which is
+ *      faster than sortLL on large lists whose nodes are scattered.
+ * 
+ * list: the linked list to perform sort operation on.
+ * 
+ * return: 1 if sucessful. 0 if failed.
+ * 
+ * note: needs memory for two pointers per item.  If it cannot be allocated
+ *      the list is sorted with sortLL instead.  Each node keeps its index,
+ *      so the data an iterator is on may change.
+ */
+int arraySortLL(LinkedList * list){
+    if(list == NULL){
+        return 0;
+    }
+    if(list->length < 2){
+        list->sorted = 1;
+        return 1;
+    }
+    void ** items = malloc(sizeof(void *) * list->length * 2);
+    if(items == NULL){
+        return sortLL(list);
+    }
+    int i = 0;
+    for(LinkedListNode * node = list->head; node != NULL; node = node->prev){
+        items[i++] = node->data;
+    }
+    void ** sorted = mergeSortArrayLL(list, items, items + list->length, list->length);
+    i = 0;
+    for(LinkedListNode * node = list->head; node != NULL; node = node->prev){
+        node->data = sorted[i++];
+    }
+    free(items);
+    dropSkipIndexLL(list);
+    if(list->hashIndex != NULL){
+        LinkedListHashIndex * hashIndex = list->hashIndex;
+        long label = 0;
+        memset(hashIndex->entries, 0, sizeof(LinkedListHashEntry) * hashIndex->capacity);
+        for(LinkedListNode * node = list->head; node != NULL; node = node->prev){
+            putHashEntry(hashIndex, node, list->hashData(node->data), label++);
+        }
+        hashIndex->firstLabel = 0;
+        hashIndex->lastLabel = label - 1;
+        hashIndex->labelled = 1;
+    }
+    list->sorted = 1;
+    return 1;
+}
+
+/*
+ * Function: enableSkipIndexLL
+ * ----------------------------
+ * Attaches a skip index to the list.  The index is built the first time
+ *      searchLL or insertSortedLL is called while the list is sorted, kept
+ *      up to date by insertSortedLL and removals, and dropped by any other
+ *      insert and by sortLL until it is next needed.
+ *
+ * list: the linked list to index.
+ *
+ * return: 1 if sucessful. 0 if failed.
+ */
+int enableSkipIndexLL(LinkedList * list){
+    if(list == NULL){
+        return 0;
+    }
+    if(list->skipIndex != NULL){
+        return 1;
+    }
+    LinkedListSkipIndex * skipIndex = malloc(sizeof(LinkedListSkipIndex));
+    if(skipIndex == NULL){
+        return 0;
+    }
+    if((skipIndex->header = createSkipNode(NULL, LL_SKIP_MAX_LEVEL)) == NULL){
+        free(skipIndex);
+        return 0;
+    }
+    skipIndex->level = 0;
+    skipIndex->built = 0;
+    skipIndex->seed = 2463534242u;
+    list->skipIndex = skipIndex;
+    return 1;
+}
+
+/*
+ * Function: disableSkipIndexLL
+ * ----------------------------
+ * Frees the skip index of the list.
+ *
+ * list: the linked list to stop indexing.
+ *
+ * return: 1 if sucessful. 0 if failed.
+ */
+int disableSkipIndexLL(LinkedList * list){
+    if(list == NULL){
+        return 0;
+    }
+    if(list->skipIndex != NULL){
+        dropSkipIndexLL(list);
+        free(list->skipIndex->header);
+        free(list->skipIndex);
+        list->skipIndex = NULL;
+    }
+    return 1;
+}
+
+/*
+ * Function: enableHashIndexLL
  * ----------------------------
- * splits a unsorted list into two unsorted list
- * 
- * node: the head of the list to be sorted.
- * 
- * return: the head of the second list
- * note: the pointer originally passed into the function acts
- *      as the first lists head after splitting.
+ * Attaches a hash index to the list and adds every item already in it.
+ *      From then on searchLL and containsLL look items up by hash.
+ *
+ * list: the linked list to index.
+ * hashFunc: a function pointer that hashes the intended data type.  Items
+ *      that compare equal must hash equal.
+ *
+ * return: 1 if sucessful. 0 if failed.
+ *
+ * note: the data of an item must not be changed in a way that changes its
+ *      hash while it is in an indexed list.
  */
-LinkedListNode * split(LinkedListNode * node){
-    LinkedListNode * half = node;
-    LinkedListNode * full = node;
-    while(full->prev != NULL && full->prev->prev != NULL){
-        half = half->prev;
-        full = full->prev->prev;
+int enableHashIndexLL(LinkedList * list, unsigned long (*hashFunc)(void * data)){
+    if(list == NULL || hashFunc == NULL){
+        return 0;
     }
-    half = half->prev;
-    half->next->prev = NULL;
-    half->next = NULL;
-
-    return half;
+    disableHashIndexLL(list);
+    LinkedListHashIndex * hashIndex = malloc(sizeof(LinkedListHashIndex));
+    if(hashIndex == NULL){
+        return 0;
+    }
+    hashIndex->capacity = LL_HASH_INITIAL_CAPACITY;
+    while(hashIndex->capacity < (list->length + 1) * 2){
+        hashIndex->capacity *= 2;
+    }
+    if((hashIndex->entries = calloc(hashIndex->capacity, sizeof(LinkedListHashEntry))) == NULL){
+        free(hashIndex);
+        return 0;
+    }
+    hashIndex->count = list->length;
+    hashIndex->labelled = 1;
+    list->hashData = hashFunc;
+    list->hashIndex = hashIndex;
+    long label = 0;
+    for(LinkedListNode * node = list->head; node != NULL; node = node->prev){
+        putHashEntry(hashIndex, node, hashFunc(node->data), label++);
+    }
+    hashIndex->firstLabel = 0;
+    hashIndex->lastLabel = label - 1;
+    return 1;
 }
 
 /*
- * Function: mergeSort
+ * Function: disableHashIndexLL
  * ----------------------------
- * sorts a doubly linked list using the mergesort algorithm
- * 
- * list: the linked list data structure to be sorted.
- * first: the head of an unsorted list that must be sorted.
- * 
- * return: the list passed in using first after sorting.
+ * Frees the hash index of the list.
+ *
+ * list: the linked list to stop indexing.
+ *
+ * return: 1 if sucessful. 0 if failed.
  */
-void * mergeSort(LinkedList * list, LinkedListNode * first){
-    LinkedListNode * second;
-
-    if(first == NULL || first->prev == NULL){
-        return first;
+int disableHashIndexLL(LinkedList * list){
+    if(list == NULL){
+        return 0;
     }
-
-    second = split(first);
-
-    first = mergeSort(list, first);
-    second = mergeSort(list, second);
-
-
-    first = merge(list, first, second);
-    return first;
+    if(list->hashIndex != NULL){
+        free(list->hashIndex->entries);
+        free(list->hashIndex);
+        list->hashIndex = NULL;
+    }
+    return 1;
 }
 
-/**end internal functions**/
-
 /*
- * Function: createLinkedList
+ * Function: containsLL
  * ----------------------------
- * Creates a pointer to a linked list data structures
- * 
- * destroyFunc: a function pointer that destroys the data type intended
- *      to be stored in the stack
- * compareFunc: a function pointer that compares two of the intended data type.
- * 
- * return: a pointer to the created linked list
+ * Checks whether an item equal to data is in the list.  O(1) average with
+ *      a hash index, otherwise a sequential scan.
+ *
+ * list: the linked list to check.
+ * data: the item to look for.
+ *
+ * return: 1 if the item is in the list. 0 if not or the list is NULL.
  */
-LinkedList * createLinkedList(void (*destroyFunc)(void * data), int (*compareFunc)(void * a, void * b)){
-    LinkedList * list = malloc(sizeof(LinkedList));
-    list->destroyData = destroyFunc;
-    list->compareData = compareFunc;
-    list->head = NULL;
-    list->tail = NULL;
-    list->length = 0;
-    list->sorted = 1;
-    return list;
+int containsLL(LinkedList * list, void * data){
+    if(list == NULL){
+        return 0;
+    }
+    if(list->hashIndex != NULL){
+        return searchHashIndexLL(list, data, NULL) != NULL;
+    }
+    for(LinkedListNode * node = list->head; node != NULL; node = node->prev){
+        if(list->compareData(data, node->data) == 0){
+            return 1;
+        }
+    }
+    return 0;
 }
 
+
 /*
- * Function: addToFrontLL
+ * Function: spliceLL
  * ----------------------------
- * Adds new data to the front of the list
+ * Moves count items starting at index first of src into dest in front of
+ *      index, keeping their order.  The nodes are relinked rather than
+ *      copied, so only the ends of the range are searched for.
  * 
- * list: the linked list to perform the add to front operation on.
- * data: the data to added to the front of the list.
+ * dest: the linked list to move the items into.
+ * index: the index in dest the first moved item will have.
+ * src: the linked list to move the items out of.  Must not be dest.
+ * first: the index in src of the first item to move.
+ * count: the number of items to move.
  * 
  * return: an integer indicating the success or failure of the operation
- * 0: failure
+ * 0: failure, neither list is changed
  * 1: success
+ * 
+ * note: if the lists allocate their nodes from different places, one
+ *      pooled and one not or from two different pools, dest allocates new
+ *      nodes for the items instead.  Iterators on either list may be left
+ *      on the wrong index.
  */
-int addToFrontLL(LinkedList * list, void * data){
-    if(list == NULL){
+int spliceLL(LinkedList * dest, int index, LinkedList * src, int first, int count){
+    if(dest == NULL || src == NULL || dest == src){
         return 0;
     }
-    LinkedListNode * node = createLinkedListNode(NULL, list->head, data);
-    if(list->head != NULL){
-        list->head->next = node;
-    }
-    list->head = node;
-    if(list->tail == NULL){
-        list->tail = node;
-    }
-    list->length++;
-    if(list->length > 1){
-        list->sorted = 0;
+    if(index < 0 || index > dest->length || first < 0 || count < 0 || count > src->length - first){
+        return 0;
     }
-    return 1;
+    return moveRangeLL(dest, index, src, first, count);
 }
 
 /*
- * Function: addToBackLL
+ * Function: concatLL
  * ----------------------------
- * Adds new data to the back of the list
+ * Moves every item of b to the back of a, leaving b empty.  O(1) when the
+ *      lists allocate from the same place and neither is indexed.
  * 
- * list: the linked list to perform the add to back operation on.
- * data: the data to added to the back of the list.
+ * a: the linked list to append to.
+ * b: the linked list to append.  Must not be a.
  * 
  * return: an integer indicating the success or failure of the operation
- * 0: failure
+ * 0: failure, neither list is changed
  * 1: success
  */
-int addToBackLL(LinkedList * list, void * data){
-    if(list == NULL){
+int concatLL(LinkedList * a, LinkedList * b){
+    if(a == NULL || b == NULL || a == b){
         return 0;
     }
-    LinkedListNode * node = createLinkedListNode(list->tail, NULL, data);
-    if(list->tail != NULL){
-        list->tail->prev = node;
-    }
-    list->tail = node;
-    if(list->head == NULL){
-        list->head = node;
-    }
-    list->length++;
-    if(list->length > 1){
-        list->sorted = 0;
-    }
-    return 1;
+    return moveRangeLL(a, a->length, b, 0, b->length);
 }
 
 /*
- * Function: insertAtIndexLL
+ * Function: mergeSortedLL
  * ----------------------------
- * Adds new data to the position of the index
+ * Merges the items of src into dest in order, leaving src empty.  Both
+ *      lists must be sorted.  The nodes of src are relinked by a single
+ *      linear merge rather than re-sorting, so it takes O(n + m)
+ *      comparisons and dest stays sorted.
  * 
- * list: the linked list to perform the insert operation on.
- * data: the data to be inserted.
- * index: the index of where to insert the data
+ * dest: the sorted linked list to merge into.
+ * src: the sorted linked list to merge from.  Must not be dest.
  * 
  * return: an integer indicating the success or failure of the operation
- * 0: failure
+ * 0: failure, neither list is changed
  * 1: success
+ * 
+ * note: the merge is stable, items of dest come before equal items of src.
+ *      If the lists allocate their nodes from different places dest
+ *      allocates new nodes for the items of src, as with spliceLL.
  */
-int insertAtIndexLL(LinkedList * list, void * data, int index){
-    if(list == NULL){
-        return 0;
-    }
-    if(index > list->length || index < 0){
+int mergeSortedLL(LinkedList * dest, LinkedList * src){
+    if(dest == NULL || src == NULL || dest == src || !dest->sorted || !src->sorted){
         return 0;
     }
-    LinkedListNode * node = list->head;
-    LinkedListNode * newNode;
-    if(index == 0  || list->head == NULL){
-        return addToFrontLL(list, data);
-    }
-    else if(index == list->length){
-        return addToBackLL(list, data);
+    if(src->length == 0){
+        return 1;
     }
-    for(int i = 1; i < index; i++){
-        node = node->prev;
+    LinkedListNode * last;
+    int count = src->length;
+    LinkedListNode * first = takeRangeLL(dest, src, 0, count, &last);
+    if(first == NULL){
+        return 0;
     }
-    newNode = createLinkedListNode(node, node->prev, data);
-    node->prev->next = newNode;
-    node->prev = newNode;
-    list->length++;
-    if(list->length > 1){
-        list->sorted = 0;
+    if(dest->hashIndex != NULL){
+        for(LinkedListNode * node = first; node != NULL; node = node->prev){
+            putHashEntry(dest->hashIndex, node, dest->hashData(node->data), 0);
+        }
+        dest->hashIndex->count += count;
+        dest->hashIndex->labelled = 0;
     }
+    dropSkipIndexLL(dest);
+    relinkLL(dest, merge(dest, dest->head, first));
+    dest->length += count;
+    dest->cursor = NULL;
     return 1;
 }
 
 /*
- * Function: removeFromIndexLL
+ * Function: splitAtLL
  * ----------------------------
- * removes item from position of the index and returns it.
+ * Moves the items from index to the end of the list into a new list.  The
+ *      new list shares the node pool of the list, if it has one, so the
+ *      nodes are relinked rather than copied.
  * 
- * list: the linked list to perform the remove operation on.
- * index: the index of the data to be removed.
+ * list: the linked list to split.
+ * index: the index of the first item to move.  The list's length gives an
+ *      empty new list.
  * 
- * return: a pointer of the data of the removed item.
+ * return: a pointer to the new list holding the moved items.  NULL if
+ *      failed, in which case the list is not changed.
+ * 
+ * note: A list and the lists split from it that share a pool may not be
+ *      used from different threads at the same time, since the pool's free
+ *      list is not locked.
  */
-void * removeFromIndexLL(LinkedList * list, int index){
-    if(list == NULL || index < 0 || index >= list->length){
+LinkedList * splitAtLL(LinkedList * list, int index){
+    if(list == NULL || index < 0 || index > list->length){
         return NULL;
     }
-    LinkedListNode * node = list->head;
-
-    void * data;
-    for(int i = 0; i < index; i++){
-        node = node->prev;
-    }
-
-    if(node->next != NULL){
-        node->next->prev = node->prev;
-    }
-    else{
-        list->head = node->prev;
-
-    }
-    if(node->prev != NULL){
-        node->prev->next = node->next;
+    LinkedList * rest = createLinkedList(list->destroyData, list->compareData);
+    if(rest == NULL){
+        return NULL;
     }
-    else{
-        list->tail = node->next;
+    if(list->pool != NULL){
+        rest->pool = list->pool;
+        list->pool->users++;
     }
-    data = node->data;
-    free(node);
-    list->length--;
-    if(list->length < 2){
-        list->sorted = 1;
+    rest->sortThreads = list->sortThreads;
+    rest->sortCutoff = list->sortCutoff;
+    if(!moveRangeLL(rest, 0, list, index, list->length - index)){
+        destroyLinkedList(rest);
+        return NULL;
     }
-    return data;
+    return rest;
 }
 
 /*
- * Function: getLL
+ * Function: iterBeginLL
  * ----------------------------
- * retrieve the item at the given index.
+ * Creates an iterator positioned at the head of the list.
  * 
- * list: the linked list to perform the get operation on.
- * index: the index of the data to be retreive.
+ * list: the linked list to iterate over.
  * 
- * return: a pointer of the data at the given index.
+ * return: an iterator on index 0.  The iterator is not valid if the list
+ *      is empty or NULL.
  */
-void * getLL(LinkedList * list, int index){
-    if(list == NULL || index < 0 || index > list->length - 1 || list->head == NULL){
+LinkedListIterator iterBeginLL(LinkedList * list){
+    LinkedListIterator iterator;
+    iterator.list = list;
+    iterator.node = list == NULL ? NULL : list->head;
+    iterator.index = 0;
+    return iterator;
+}
+
+/*
+ * Function: iterEndLL
+ * ----------------------------
+ * Creates an iterator positioned at the tail of the list, for walking the
+ *      list backwards.
+ * 
+ * list: the linked list to iterate over.
+ * 
+ * return: an iterator on the last index.  The iterator is not valid if the
+ *      list is empty or NULL.
+ */
+LinkedListIterator iterEndLL(LinkedList * list){
+    LinkedListIterator iterator;
+    iterator.list = list;
+    iterator.node = list == NULL ? NULL : list->tail;
+    iterator.index = list == NULL ? 0 : list->length - 1;
+    return iterator;
+}
+
+/*
+ * Function: iterValidLL
+ * ----------------------------
+ * Checks whether the iterator is positioned on an item.
+ * 
+ * iterator: the iterator to check.
+ * 
+ * return: 1 if the iterator is on an item. 0 if it has run off either end.
+ */
+int iterValidLL(LinkedListIterator * iterator){
+    return iterator != NULL && iterator->node != NULL;
+}
+
+/*
+ * Function: iterGetLL
+ * ----------------------------
+ * retrieve the item the iterator is positioned on.
+ * 
+ * iterator: the iterator to read.
+ * 
+ * return: a pointer of the data at the iterator.  NULL if not valid.
+ */
+void * iterGetLL(LinkedListIterator * iterator){
+    if(!iterValidLL(iterator)){
         return NULL;
     }
-    LinkedListNode * node;
-    if(index > list->length/2){
-        node = list->tail;
-        for(int i = list->length - 1; i > index; i--){
-            node = node->next;
-        }
-    }
-    else{
-        node = list->head;
-        for(int i = 0; i < index; i++){
-            node = node->prev;
-        }
-    }
-    return node->data;
+    return iterator->node->data;
 }
 
 /*
- * Function: searchLL
+ * Function: iterNextLL
  * ----------------------------
- * Sequentially checks each item.
+ * moves the iterator one item towards the tail.
  * 
- * list: the linked list to perform the search operation on.
- * data: the item to be found.
+ * iterator: the iterator to move.
  * 
- * return: the index of the item searched for.  -1 if not found.
+ * return: 1 if the iterator is on an item after moving. 0 otherwise.
  */
-int searchLL(LinkedList * list, void * data){
-    if(list == NULL){
-        return -1;
-    }
-    int count = 0;
-    LinkedListNode * node = list->head;
-    while(node != NULL){
-        if(list->compareData(data, node->data) == 0){
-            return count; 
-        }
-        node = node->prev;
-        count++;
+int iterNextLL(LinkedListIterator * iterator){
+    if(!iterValidLL(iterator)){
+        return 0;
     }
-    return -1;
+    iterator->node = iterator->node->prev;
+    iterator->index++;
+    return iterator->node != NULL;
 }
 
 /*
- * Function: insertSortedLL
+ * Function: iterPrevLL
  * ----------------------------
- * insert an item into a sorted list.
+ * moves the iterator one item towards the head.
  * 
- * list: the linked list to perform the insert operation on.
- * data: the item to be inserted into the list.
+ * iterator: the iterator to move.
  * 
- * return: the index the item was inserted to.  -1 if failed.
+ * return: 1 if the iterator is on an item after moving. 0 otherwise.
  */
-int insertSortedLL(LinkedList * list, void * data){
-    if(list == NULL || list->sorted == 0){
-        return -1;
+int iterPrevLL(LinkedListIterator * iterator){
+    if(!iterValidLL(iterator)){
+        return 0;
     }
-    LinkedListNode * node = list->head;
-    LinkedListNode * newNode;
-    int index = 0;
-    while(node != NULL){
-        if(list->compareData(node->data, data) > 0){
-            newNode = createLinkedListNode(node->next, node, data);
-            if(node->next == NULL){
-                list->head = newNode;
-            }
-            else{
-                node->next->prev = newNode;
-            }
-            node->next = newNode;
-            list->length++;
-            return index;
-        }
-        index++;
-        node = node->prev;
+    iterator->node = iterator->node->next;
+    iterator->index--;
+    return iterator->node != NULL;
+}
+
+/*
+ * Function: iterRemoveLL
+ * ----------------------------
+ * removes the item the iterator is positioned on and moves the iterator to
+ *      the item that followed it.
+ * 
+ * iterator: the iterator to perform the remove operation with.
+ * 
+ * return: a pointer of the data of the removed item.  NULL if not valid.
+ */
+void * iterRemoveLL(LinkedListIterator * iterator){
+    if(!iterValidLL(iterator)){
+        return NULL;
     }
-    addToBackLL(list, data);
-    list->sorted = 1;
-    return index;
+    LinkedListNode * node = iterator->node;
+    void * data = node->data;
+    iterator->node = node->prev;
+    unlinkLL(iterator->list, node, iterator->index);
+    freeLinkedListNode(iterator->list, node);
+    return data;
 }
 
 /*
- * Function: sortLL
+ * Function: iterInsertBeforeLL
  * ----------------------------
- * Sorts the linked list using a merge sort algorithm
+ * inserts data in front of the item the iterator is positioned on.  The
+ *      iterator stays on the same item.  If the iterator has run off the
+ *      tail of the list the data is added to the back of the list.
  * 
- * list: the linked list to perform sort operation on.
+ * iterator: the iterator to perform the insert operation with.
+ * data: the data to be inserted.
  * 
- * return: 1 if sucessful. 0 if failed.
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
  */
-int sortLL(LinkedList * list){
-    if(list == NULL){
+int iterInsertBeforeLL(LinkedListIterator * iterator, void * data){
+    if(iterator == NULL || iterator->list == NULL){
         return 0;
     }
-    list->head = mergeSort(list, list->head);
-    list->sorted = 1;
-    return 1;    
+    LinkedList * list = iterator->list;
+    if(iterator->node == NULL){
+        if(iterator->index != list->length){
+            return 0;
+        }
+        if(!addToBackLL(list, data)){
+            return 0;
+        }
+        iterator->index++;
+        return 1;
+    }
+    if(linkBeforeLL(list, iterator->node, data, iterator->index) == NULL){
+        return 0;
+    }
+    dropSkipIndexLL(list);
+    list->sorted = 0;
+    iterator->index++;
+    return 1;
 }
 
-
 /*
  * Function: destroyLinkedList
  * ----------------------------
@@ -405,9 +2067,16 @@ int destroyLinkedList(LinkedList * list){
     while(node != NULL){
         list->destroyData(node->data);
         temp = node->prev;
-        free(node);
+        if(list->pool == NULL || list->pool->users > 1){
+            freeLinkedListNode(list, node);
+        }
         node = temp;
     }
+    if(list->pool != NULL && --list->pool->users == 0){
+        destroyNodePool(list->pool);
+    }
+    disableSkipIndexLL(list);
+    disableHashIndexLL(list);
     free(list);
     return 1;
 }
\ No newline at end of file
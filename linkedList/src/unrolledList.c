@@ -0,0 +1,475 @@
+#include <string.h>
+#include "unrolledList.h"
+
+/**internal functions**/
+
+/*
+ * Function: createUnrolledListNode
+ * ----------------------------
+ * allocates an empty node and links it after prev, or at the head of the
+ *      list if prev is NULL.
+ *
+ * return: the new node.  NULL if the allocation failed.
+ */
+UnrolledListNode * createUnrolledListNode(UnrolledList * list, UnrolledListNode * prev){
+    UnrolledListNode * node = malloc(sizeof(UnrolledListNode));
+    if(node == NULL){
+        return NULL;
+    }
+    node->count = 0;
+    node->prev = prev;
+    node->next = prev == NULL ? list->head : prev->next;
+    if(node->next != NULL){
+        node->next->prev = node;
+    }
+    else{
+        list->tail = node;
+    }
+    if(prev != NULL){
+        prev->next = node;
+    }
+    else{
+        list->head = node;
+    }
+    return node;
+}
+
+/*
+ * Function: unlinkUnrolledListNode
+ * ----------------------------
+ * unlinks a node from the list and frees it.  The data it held is not freed.
+ */
+void unlinkUnrolledListNode(UnrolledList * list, UnrolledListNode * node){
+    if(node->prev != NULL){
+        node->prev->next = node->next;
+    }
+    else{
+        list->head = node->next;
+    }
+    if(node->next != NULL){
+        node->next->prev = node->prev;
+    }
+    else{
+        list->tail = node->prev;
+    }
+    free(node);
+}
+
+/*
+ * Function: locate
+ * ----------------------------
+ * finds the node holding the given index, walking from whichever end of
+ *      the list is closer.
+ *
+ * list: the list to search.
+ * index: the index to find.  Must be within the bounds of the list.
+ * offset: set to the position of the index within the node.
+ *
+ * return: the node holding the index.
+ */
+UnrolledListNode * locate(UnrolledList * list, int index, int * offset){
+    UnrolledListNode * node;
+    if(index < list->length / 2){
+        node = list->head;
+        while(index >= node->count){
+            index -= node->count;
+            node = node->next;
+        }
+        *offset = index;
+        return node;
+    }
+    index = list->length - 1 - index;
+    node = list->tail;
+    while(index >= node->count){
+        index -= node->count;
+        node = node->prev;
+    }
+    *offset = node->count - 1 - index;
+    return node;
+}
+
+/*
+ * Function: insertIntoNode
+ * ----------------------------
+ * inserts data at offset within node.  A full node is first split in half,
+ *      moving the upper half of its items into a new node after it.
+ *
+ * list: the list being inserted into.
+ * node: the node to insert into.
+ * offset: the position within the node, from 0 to node->count.
+ * data: the data to be inserted.
+ *
+ * return: 1 if sucessful. 0 if failed.
+ */
+int insertIntoNode(UnrolledList * list, UnrolledListNode * node, int offset, void * data){
+    if(node->count == UL_NODE_CAPACITY){
+        UnrolledListNode * newNode = createUnrolledListNode(list, node);
+        if(newNode == NULL){
+            return 0;
+        }
+        newNode->count = UL_NODE_CAPACITY - UL_NODE_CAPACITY / 2;
+        memcpy(newNode->data, node->data + UL_NODE_CAPACITY / 2, sizeof(void *) * newNode->count);
+        node->count = UL_NODE_CAPACITY / 2;
+        if(offset > node->count){
+            offset -= node->count;
+            node = newNode;
+        }
+    }
+    memmove(node->data + offset + 1, node->data + offset, sizeof(void *) * (node->count - offset));
+    node->data[offset] = data;
+    node->count++;
+    list->length++;
+    return 1;
+}
+
+/*
+ * Function: mergeSortArray
+ * ----------------------------
+ * sorts items[0..count) using a stable top down merge sort.
+ *
+ * list: the list that contains the comparison function.
+ * items: the array to be sorted.
+ * buffer: scratch space at least count items long.
+ * count: the number of items.
+ */
+void mergeSortArray(UnrolledList * list, void ** items, void ** buffer, int count){
+    if(count < 2){
+        return;
+    }
+    int half = count / 2;
+    int a = 0;
+    int b = half;
+    int i = 0;
+    mergeSortArray(list, items, buffer, half);
+    mergeSortArray(list, items + half, buffer, count - half);
+    if(list->compareData(items[half], items[half - 1]) >= 0){
+        return;
+    }
+    while(a < half && b < count){
+        if(list->compareData(items[b], items[a]) < 0){
+            buffer[i++] = items[b++];
+        }
+        else{
+            buffer[i++] = items[a++];
+        }
+    }
+    while(a < half){
+        buffer[i++] = items[a++];
+    }
+    memcpy(items, buffer, sizeof(void *) * i);
+}
+
+/**end internal functions**/
+
+/*
+ * Function: createUnrolledList
+ * ----------------------------
+ * Creates a pointer to an unrolled linked list data structure
+ *
+ * destroyFunc: a function pointer that destroys the data type intended
+ *      to be stored in the list
+ * compareFunc: a function pointer that compares two of the intended data type.
+ *
+ * return: a pointer to the created list.  NULL if failed.
+ */
+UnrolledList * createUnrolledList(void (*destroyFunc)(void * data), int (*compareFunc)(void * a, void * b)){
+    UnrolledList * list = malloc(sizeof(UnrolledList));
+    if(list == NULL){
+        return NULL;
+    }
+    list->destroyData = destroyFunc;
+    list->compareData = compareFunc;
+    list->head = NULL;
+    list->tail = NULL;
+    list->length = 0;
+    list->sorted = 1;
+    return list;
+}
+
+/*
+ * Function: addToFrontUL
+ * ----------------------------
+ * Adds new data to the front of the list
+ *
+ * list: the list to perform the add to front operation on.
+ * data: the data to added to the front of the list.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int addToFrontUL(UnrolledList * list, void * data){
+    if(list == NULL){
+        return 0;
+    }
+    UnrolledListNode * node = list->head;
+    if(node == NULL || node->count == UL_NODE_CAPACITY){
+        if((node = createUnrolledListNode(list, NULL)) == NULL){
+            return 0;
+        }
+    }
+    if(!insertIntoNode(list, node, 0, data)){
+        return 0;
+    }
+    if(list->length > 1){
+        list->sorted = 0;
+    }
+    return 1;
+}
+
+/*
+ * Function: addToBackUL
+ * ----------------------------
+ * Adds new data to the back of the list
+ *
+ * list: the list to perform the add to back operation on.
+ * data: the data to added to the back of the list.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int addToBackUL(UnrolledList * list, void * data){
+    if(list == NULL){
+        return 0;
+    }
+    UnrolledListNode * node = list->tail;
+    if(node == NULL || node->count == UL_NODE_CAPACITY){
+        if((node = createUnrolledListNode(list, list->tail)) == NULL){
+            return 0;
+        }
+    }
+    node->data[node->count] = data;
+    node->count++;
+    list->length++;
+    if(list->length > 1){
+        list->sorted = 0;
+    }
+    return 1;
+}
+
+/*
+ * Function: insertAtIndexUL
+ * ----------------------------
+ * Adds new data to the position of the index
+ *
+ * list: the list to perform the insert operation on.
+ * data: the data to be inserted.
+ * index: the index of where to insert the data
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int insertAtIndexUL(UnrolledList * list, void * data, int index){
+    int offset;
+    if(list == NULL || index < 0 || index > list->length){
+        return 0;
+    }
+    if(index == list->length){
+        return addToBackUL(list, data);
+    }
+    UnrolledListNode * node = locate(list, index, &offset);
+    if(!insertIntoNode(list, node, offset, data)){
+        return 0;
+    }
+    list->sorted = 0;
+    return 1;
+}
+
+/*
+ * Function: removeFromIndexUL
+ * ----------------------------
+ * removes item from position of the index and returns it.
+ *
+ * list: the list to perform the remove operation on.
+ * index: the index of the data to be removed.
+ *
+ * return: a pointer of the data of the removed item.
+ *
+ * implementation details: a node left less than half full is merged with
+ *      the node after it when their items fit in one node, so nodes stay
+ *      at least half full on average.
+ */
+void * removeFromIndexUL(UnrolledList * list, int index){
+    int offset;
+    if(list == NULL || index < 0 || index >= list->length){
+        return NULL;
+    }
+    UnrolledListNode * node = locate(list, index, &offset);
+    UnrolledListNode * next = node->next;
+    void * data = node->data[offset];
+    node->count--;
+    memmove(node->data + offset, node->data + offset + 1, sizeof(void *) * (node->count - offset));
+    if(node->count == 0){
+        unlinkUnrolledListNode(list, node);
+    }
+    else if(node->count < UL_NODE_CAPACITY / 2 && next != NULL && node->count + next->count <= UL_NODE_CAPACITY){
+        memcpy(node->data + node->count, next->data, sizeof(void *) * next->count);
+        node->count += next->count;
+        unlinkUnrolledListNode(list, next);
+    }
+    list->length--;
+    if(list->length < 2){
+        list->sorted = 1;
+    }
+    return data;
+}
+
+/*
+ * Function: getUL
+ * ----------------------------
+ * retrieve the item at the given index.
+ *
+ * list: the list to perform the get operation on.
+ * index: the index of the data to be retreive.
+ *
+ * return: a pointer of the data at the given index.
+ */
+void * getUL(UnrolledList * list, int index){
+    int offset;
+    if(list == NULL || index < 0 || index >= list->length){
+        return NULL;
+    }
+    UnrolledListNode * node = locate(list, index, &offset);
+    return node->data[offset];
+}
+
+/*
+ * Function: searchUL
+ * ----------------------------
+ * Sequentially checks each item.
+ *
+ * list: the list to perform the search operation on.
+ * data: the item to be found.
+ *
+ * return: the index of the item searched for.  -1 if not found.
+ */
+int searchUL(UnrolledList * list, void * data){
+    if(list == NULL){
+        return -1;
+    }
+    int index = 0;
+    for(UnrolledListNode * node = list->head; node != NULL; node = node->next){
+        for(int i = 0; i < node->count; i++){
+            if(list->compareData(data, node->data[i]) == 0){
+                return index + i;
+            }
+        }
+        index += node->count;
+    }
+    return -1;
+}
+
+/*
+ * Function: insertSortedUL
+ * ----------------------------
+ * insert an item into a sorted list.
+ *
+ * list: the list to perform the insert operation on.
+ * data: the item to be inserted into the list.
+ *
+ * return: the index the item was inserted to.  -1 if failed.
+ *
+ * implementation details: whole nodes whose last item is not greater than
+ *      data are skipped with a single comparison each.
+ */
+int insertSortedUL(UnrolledList * list, void * data){
+    if(list == NULL || list->sorted == 0){
+        return -1;
+    }
+    UnrolledListNode * node = list->head;
+    int index = 0;
+    int offset = 0;
+    while(node != NULL && list->compareData(node->data[node->count - 1], data) <= 0){
+        index += node->count;
+        node = node->next;
+    }
+    if(node == NULL){
+        if(!addToBackUL(list, data)){
+            return -1;
+        }
+        list->sorted = 1;
+        return index;
+    }
+    while(list->compareData(node->data[offset], data) <= 0){
+        offset++;
+    }
+    if(!insertIntoNode(list, node, offset, data)){
+        return -1;
+    }
+    return index + offset;
+}
+
+/*
+ * Function: sortUL
+ * ----------------------------
+ * Sorts the list using a stable merge sort algorithm.  The items are
+ *      copied into a temporary array, sorted and written back into the
+ *      nodes, so the node structure is unchanged.
+ *
+ * list: the list to perform sort operation on.
+ *
+ * return: 1 if sucessful. 0 if failed.
+ */
+int sortUL(UnrolledList * list){
+    if(list == NULL){
+        return 0;
+    }
+    if(list->length < 2){
+        list->sorted = 1;
+        return 1;
+    }
+    void ** items = malloc(sizeof(void *) * list->length * 2);
+    int count = 0;
+    if(items == NULL){
+        return 0;
+    }
+    for(UnrolledListNode * node = list->head; node != NULL; node = node->next){
+        memcpy(items + count, node->data, sizeof(void *) * node->count);
+        count += node->count;
+    }
+    mergeSortArray(list, items, items + count, count);
+    count = 0;
+    for(UnrolledListNode * node = list->head; node != NULL; node = node->next){
+        memcpy(node->data, items + count, sizeof(void *) * node->count);
+        count += node->count;
+    }
+    free(items);
+    list->sorted = 1;
+    return 1;
+}
+
+/*
+ * Function: destroyUnrolledList
+ * ----------------------------
+ * Frees the list and all data stored in the list using
+ *      the destroyData function pointer
+ *
+ * list: the list to perform the destroy operation on.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ *
+ * note: If data is desired to be intact after the destruction of the list
+ *      pass a function pointer that does not destroy the data when initializing
+ *      the list.
+ */
+int destroyUnrolledList(UnrolledList * list){
+    if(list == NULL){
+        return 0;
+    }
+    UnrolledListNode * node = list->head;
+    UnrolledListNode * temp;
+    while(node != NULL){
+        for(int i = 0; i < node->count; i++){
+            list->destroyData(node->data[i]);
+        }
+        temp = node->next;
+        free(node);
+        node = temp;
+    }
+    free(list);
+    return 1;
+}
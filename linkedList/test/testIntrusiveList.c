@@ -0,0 +1,250 @@
+#include <stdio.h>
+#include <string.h>
+#include "unity.h"
+#include "intrusiveList.h"
+
+/*
+ * Struct: Job
+ * ----------------------------
+ * An item that can be in two intrusive lists at once, ordered by priority
+ *      only so the sort can be checked for stability using id.
+ */
+typedef struct job{
+    int priority;
+    int id;
+    IntrusiveLink byQueue;
+    IntrusiveLink byOwner;
+}Job;
+
+int destroyed;
+
+void countDestroy(void * data){
+    destroyed++;
+}
+
+int compareJobs(void * a, void * b){
+    Job * x = a;
+    Job * y = b;
+    return (x->priority > y->priority) - (x->priority < y->priority);
+}
+
+void setUp(void) {
+    // set stuff up here
+    destroyed = 0;
+}
+
+void tearDown(void) {
+    // clean stuff up here
+}
+
+/*
+ * Function: checkIL
+ * ----------------------------
+ * checks an IntrusiveList against an array of items, walking the list from
+ *      both ends.
+ */
+void checkIL(IntrusiveList * list, Job ** expected, int length, char * message){
+    IntrusiveLink * link = list->head;
+    TEST_ASSERT_EQUAL_INT_MESSAGE(length, list->length, message);
+    for(int i = 0; i < length; i++, link = link->prev){
+        TEST_ASSERT_NOT_NULL_MESSAGE(link, message);
+        TEST_ASSERT_EQUAL_PTR_MESSAGE(expected[i], IL_ENTRY(link, Job, byQueue), message);
+    }
+    TEST_ASSERT_NULL_MESSAGE(link, message);
+    link = list->tail;
+    for(int i = length - 1; i >= 0; i--, link = link->next){
+        TEST_ASSERT_NOT_NULL_MESSAGE(link, message);
+        TEST_ASSERT_EQUAL_PTR_MESSAGE(expected[i], IL_ENTRY(link, Job, byQueue), message);
+    }
+    TEST_ASSERT_NULL_MESSAGE(link, message);
+}
+
+/*
+ * Test: test_intrusive_null
+ * ----------------------------
+ * Test that the intrusive list functions handle NULL lists and items and
+ *      bad indexes.
+ */
+void test_intrusive_null(void){
+    IntrusiveList * list = createIntrusiveList(offsetof(Job, byQueue), NULL, &compareJobs);
+    Job job = {1, 1};
+    TEST_ASSERT_NOT_NULL_MESSAGE(list, "createIntrusiveList returned NULL");
+    TEST_ASSERT_EQUAL_INT(0, addToFrontIL(NULL, &job));
+    TEST_ASSERT_EQUAL_INT(0, addToBackIL(list, NULL));
+    TEST_ASSERT_EQUAL_INT(0, insertAtIndexIL(list, &job, 1));
+    TEST_ASSERT_EQUAL_INT(0, insertAtIndexIL(list, &job, -1));
+    TEST_ASSERT_NULL(removeFromIndexIL(list, 0));
+    TEST_ASSERT_EQUAL_INT(0, removeIL(list, &job));
+    TEST_ASSERT_NULL(getIL(list, 0));
+    TEST_ASSERT_NULL(getIL(NULL, 0));
+    TEST_ASSERT_EQUAL_INT(-1, searchIL(list, &job));
+    TEST_ASSERT_EQUAL_INT(-1, insertSortedIL(NULL, &job));
+    TEST_ASSERT_EQUAL_INT(0, sortIL(NULL));
+    TEST_ASSERT_EQUAL_INT(0, destroyIntrusiveList(NULL));
+    TEST_ASSERT_EQUAL_INT(1, destroyIntrusiveList(list));
+}
+
+/*
+ * Test: test_intrusive_against_model
+ * ----------------------------
+ * Test random adds, inserts, removes, gets and searches on an
+ *      IntrusiveList against an array of the same items.
+ */
+void test_intrusive_against_model(void){
+    static Job jobs[2000];
+    Job * model[2000];
+    Job * spare[2000];
+    IntrusiveList * list = createIntrusiveList(offsetof(Job, byQueue), NULL, &compareJobs);
+    int length = 0;
+    int spares = 2000;
+    unsigned int seed = 31;
+    char errorString[100];
+    for(int i = 0; i < 2000; i++){
+        jobs[i].priority = i % 300;
+        jobs[i].id = i;
+        spare[i] = &jobs[1999 - i];
+    }
+    for(int step = 0; step < 4000; step++){
+        seed = seed * 1103515245 + 12345;
+        int op = (seed >> 8) % 7;
+        int number = (seed >> 16) % 1000;
+        if(op <= 2 && spares > 0){
+            Job * job = spare[--spares];
+            int index = op == 0 ? 0 : op == 1 ? length : number % (length + 1);
+            if(op == 0){
+                addToFrontIL(list, job);
+            }
+            else if(op == 1){
+                addToBackIL(list, job);
+            }
+            else{
+                insertAtIndexIL(list, job, index);
+            }
+            memmove(model + index + 1, model + index, sizeof(Job *) * (length - index));
+            model[index] = job;
+            length++;
+        }
+        else if(op == 3 && length > 0){
+            int index = number % length;
+            sprintf(errorString, "removed the wrong item at step %d", step);
+            TEST_ASSERT_EQUAL_PTR_MESSAGE(model[index], removeFromIndexIL(list, index), errorString);
+            spare[spares++] = model[index];
+            memmove(model + index, model + index + 1, sizeof(Job *) * (length - index - 1));
+            length--;
+        }
+        else if(op == 4 && length > 0){
+            int index = number % length;
+            TEST_ASSERT_EQUAL_INT(1, removeIL(list, model[index]));
+            spare[spares++] = model[index];
+            memmove(model + index, model + index + 1, sizeof(Job *) * (length - index - 1));
+            length--;
+        }
+        else if(op == 5 && length > 0){
+            int index = number % length;
+            sprintf(errorString, "get returned the wrong item at step %d", step);
+            TEST_ASSERT_EQUAL_PTR_MESSAGE(model[index], getIL(list, index), errorString);
+        }
+        else{
+            Job probe = {number % 300, -1};
+            int expected = -1;
+            for(int i = 0; i < length; i++){
+                if(model[i]->priority == probe.priority){
+                    expected = i;
+                    break;
+                }
+            }
+            sprintf(errorString, "search disagrees with a scan at step %d", step);
+            TEST_ASSERT_EQUAL_INT_MESSAGE(expected, searchIL(list, &probe), errorString);
+        }
+    }
+    checkIL(list, model, length, "list incorrect after random operations");
+    destroyIntrusiveList(list);
+}
+
+/*
+ * Test: test_intrusive_sort
+ * ----------------------------
+ * Test that sortIL is stable, and insertSortedIL and searchIL on the
+ *      sorted list.
+ */
+void test_intrusive_sort(void){
+    static Job jobs[600];
+    IntrusiveList * list = createIntrusiveList(offsetof(Job, byQueue), NULL, &compareJobs);
+    unsigned int seed = 9;
+    for(int i = 0; i < 600; i++){
+        seed = seed * 1103515245 + 12345;
+        jobs[i].priority = (seed >> 16) % 50;
+        jobs[i].id = i;
+    }
+    for(int i = 0; i < 500; i++){
+        addToBackIL(list, &jobs[i]);
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(-1, insertSortedIL(list, &jobs[500]), "insertSorted on an unsorted list succeeded");
+    TEST_ASSERT_EQUAL_INT(1, sortIL(list));
+    for(int i = 500; i < 600; i++){
+        int index = insertSortedIL(list, &jobs[i]);
+        TEST_ASSERT_EQUAL_PTR_MESSAGE(&jobs[i], getIL(list, index), "insertSorted returned the wrong index");
+    }
+    int length = 0;
+    for(IntrusiveLink * link = list->head; link->prev != NULL; link = link->prev, length++){
+        Job * a = IL_ENTRY(link, Job, byQueue);
+        Job * b = IL_ENTRY(link->prev, Job, byQueue);
+        TEST_ASSERT_MESSAGE(a->priority < b->priority || (a->priority == b->priority && a->id < b->id), "sort unstable");
+        TEST_ASSERT_EQUAL_PTR_MESSAGE(link, link->prev->next, "next links incorrect after sort");
+    }
+    TEST_ASSERT_EQUAL_INT(599, length);
+    Job probe = {50, -1};
+    TEST_ASSERT_EQUAL_INT_MESSAGE(-1, searchIL(list, &probe), "found a priority larger than every item");
+    probe.priority = ((Job *)getIL(list, 0))->priority;
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, searchIL(list, &probe), "did not find the first item");
+    destroyIntrusiveList(list);
+}
+
+/*
+ * Test: test_intrusive_two_lists
+ * ----------------------------
+ * Test items held by two lists through different links, moving items
+ *      between lists, and destroyData on destroy.
+ */
+void test_intrusive_two_lists(void){
+    Job jobs[10];
+    IntrusiveList * queue = createIntrusiveList(offsetof(Job, byQueue), NULL, &compareJobs);
+    IntrusiveList * done = createIntrusiveList(offsetof(Job, byQueue), NULL, &compareJobs);
+    IntrusiveList * owner = createIntrusiveList(offsetof(Job, byOwner), &countDestroy, &compareJobs);
+    for(int i = 0; i < 10; i++){
+        jobs[i].priority = i;
+        jobs[i].id = i;
+        addToBackIL(queue, &jobs[i]);
+        addToFrontIL(owner, &jobs[i]);
+    }
+    for(int i = 0; i < 10; i += 2){
+        removeIL(queue, &jobs[i]);
+        addToBackIL(done, &jobs[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(5, queue->length);
+    TEST_ASSERT_EQUAL_INT(5, done->length);
+    for(int i = 0; i < 5; i++){
+        TEST_ASSERT_EQUAL_PTR_MESSAGE(&jobs[i * 2 + 1], getIL(queue, i), "queue incorrect after moving items");
+        TEST_ASSERT_EQUAL_PTR_MESSAGE(&jobs[i * 2], getIL(done, i), "done incorrect after moving items");
+    }
+    for(int i = 0; i < 10; i++){
+        TEST_ASSERT_EQUAL_PTR_MESSAGE(&jobs[9 - i], getIL(owner, i), "second list changed by the first");
+    }
+    destroyIntrusiveList(queue);
+    destroyIntrusiveList(done);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, destroyed, "a list without destroyData destroyed items");
+    destroyIntrusiveList(owner);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(10, destroyed, "destroyData not called for each item");
+}
+
+int main(void) {
+
+    UNITY_BEGIN();
+
+    RUN_TEST(test_intrusive_null);
+    RUN_TEST(test_intrusive_against_model);
+    RUN_TEST(test_intrusive_sort);
+    RUN_TEST(test_intrusive_two_lists);
+
+    return UNITY_END();
+}
@@ -1,5 +1,6 @@
+#include <string.h>
 #include "unity.h"
-#include "LinkedList.h"
+#include "linkedList.h"
 /*
  * Struct: TestStruct
  * ----------------------------
@@ -515,6 +516,461 @@ void test_get_odd(void){
     destroyLinkedList(list);
 }
 
+/*
+ * Test: test_create_pooled_linked_list
+ * ----------------------------
+ * Ensure the createPooledLinkedList function works as expected
+ */
+void test_create_pooled_linked_list(void){
+    LinkedList * list = createPooledLinkedList(&destroyFunc, &compareFunc, 0);
+    TEST_ASSERT_NOT_NULL_MESSAGE(list, "createPooledLinkedList returned NULL");
+    TEST_ASSERT_NOT_NULL_MESSAGE(list->pool, "pool not created");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(LL_DEFAULT_SLAB_SIZE, list->pool->slabSize, "slab size not defaulted");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, list->length, "list length not initiliazed to zero");
+    destroyLinkedList(list);
+}
+
+/*
+ * Test: test_pooled_node_reuse
+ * ----------------------------
+ * Test that a removed node is recycled by the next add on a pooled list.
+ */
+void test_pooled_node_reuse(void){
+    LinkedList * list = createPooledLinkedList(&destroyFunc, &compareFunc, 2);
+    TestStruct * test1 = createTestingStruct(1, 'a');
+    TestStruct * test2 = createTestingStruct(2, 'b');
+    TestStruct * test3 = createTestingStruct(3, 'c');
+
+    addToBackLL(list, test1);
+    addToBackLL(list, test2);
+    LinkedListNode * removed = list->tail;
+    TEST_ASSERT_MESSAGE(removeFromIndexLL(list, 1) == test2, "wrong item removed");
+    addToFrontLL(list, test3);
+
+    TEST_ASSERT_MESSAGE(list->head == removed, "removed node was not reused");
+    TEST_ASSERT_NULL_MESSAGE(list->pool->slabs->next, "pool grew when a free node was available");
+    TEST_ASSERT_MESSAGE(getLL(list, 0) == test3, "head item incorrect");
+    TEST_ASSERT_MESSAGE(getLL(list, 1) == test1, "tail item incorrect");
+    free(test2);
+    destroyLinkedList(list);
+}
+
+/*
+ * Test: test_pooled_large_list
+ * ----------------------------
+ * Test that a pooled list grows across many slabs and keeps its order.
+ */
+void test_pooled_large_list(void){
+    LinkedList * list = createPooledLinkedList(&destroyFunc, &compareFunc, 16);
+    char errorString[100];
+    for(int i = 0; i < 1000; i++){
+        addToBackLL(list, createTestingStruct(i, 'a'));
+    }
+    for(int i = 0; i < 500; i++){
+        free(removeFromIndexLL(list, 0));
+    }
+    for(int i = 0; i < 500; i++){
+        addToBackLL(list, createTestingStruct(i + 1000, 'a'));
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1000, list->length, "length incorrect after churn");
+    for(int i = 0; i < 1000; i += 100){
+        sprintf(errorString, "Failed to find the correct value for i = %d", i);
+        TEST_ASSERT_EQUAL_INT_MESSAGE(i + 500, ((TestStruct*)getLL(list, i))->num, errorString);
+    }
+    destroyLinkedList(list);
+}
+
+/*
+ * Test: test_cursor_sequential_get
+ * ----------------------------
+ * Test that getLL in index order moves the cursor along the list.
+ */
+void test_cursor_sequential_get(void){
+    LinkedList * list = createLinkedList(&destroyFunc, &compareFunc);
+    for(int i = 0; i < 100; i++){
+        addToBackLL(list, createTestingStruct(i, 'a'));
+    }
+    for(int i = 0; i < 100; i++){
+        TEST_ASSERT_EQUAL_INT_MESSAGE(i, ((TestStruct*)getLL(list, i))->num, "getLL returned the wrong item");
+        TEST_ASSERT_EQUAL_INT_MESSAGE(i, list->cursorIndex, "cursor did not follow getLL");
+        TEST_ASSERT_MESSAGE(((TestStruct*)list->cursor->data)->num == i, "cursor node does not match its index");
+    }
+    destroyLinkedList(list);
+}
+
+/*
+ * Test: test_cursor_after_mutations
+ * ----------------------------
+ * Test that getLL stays correct while the list is mutated around the cursor
+ *      by comparing it against an array holding the same items.
+ */
+void test_cursor_after_mutations(void){
+    LinkedList * list = createLinkedList(&destroyFunc, &compareFunc);
+    TestStruct * model[600];
+    int length = 0;
+    unsigned int seed = 42;
+    char errorString[100];
+
+    for(int step = 0; step < 3000; step++){
+        seed = seed * 1103515245 + 12345;
+        int op = (seed >> 16) % 5;
+        int index = length == 0 ? 0 : (int)((seed >> 4) % length);
+        if(op == 0 && length < 600){
+            TestStruct * inserted = createTestingStruct(step, 'a');
+            insertAtIndexLL(list, inserted, index);
+            for(int i = length; i > index; i--){
+                model[i] = model[i - 1];
+            }
+            model[index] = inserted;
+            length++;
+        }
+        else if(op == 1 && length < 600){
+            for(int i = length; i > 0; i--){
+                model[i] = model[i - 1];
+            }
+            model[0] = createTestingStruct(step, 'b');
+            addToFrontLL(list, model[0]);
+            length++;
+        }
+        else if(op == 2 && length > 0){
+            TestStruct * removed = removeFromIndexLL(list, index);
+            sprintf(errorString, "removed wrong item at step %d", step);
+            TEST_ASSERT_MESSAGE(removed == model[index], errorString);
+            free(removed);
+            for(int i = index; i < length - 1; i++){
+                model[i] = model[i + 1];
+            }
+            length--;
+        }
+        else if(length > 0){
+            sprintf(errorString, "getLL returned the wrong item at step %d", step);
+            TEST_ASSERT_MESSAGE(getLL(list, index) == model[index], errorString);
+            if(index + 1 < length){
+                TEST_ASSERT_MESSAGE(getLL(list, index + 1) == model[index + 1], errorString);
+            }
+        }
+        TEST_ASSERT_EQUAL_INT_MESSAGE(length, list->length, "list length does not match");
+    }
+    for(int i = 0; i < length; i++){
+        sprintf(errorString, "final scan mismatch at %d", i);
+        TEST_ASSERT_MESSAGE(getLL(list, i) == model[i], errorString);
+    }
+    destroyLinkedList(list);
+}
+
+/*
+ * Test: test_iterator_walk
+ * ----------------------------
+ * Test that an iterator walks the list forwards and backwards.
+ */
+void test_iterator_walk(void){
+    LinkedList * list = createLinkedList(&destroyFunc, &compareFunc);
+    LinkedListIterator iterator = iterBeginLL(list);
+    int count = 0;
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, iterValidLL(&iterator), "iterator valid on empty list");
+    for(int i = 0; i < 10; i++){
+        addToBackLL(list, createTestingStruct(i, 'a'));
+    }
+    for(iterator = iterBeginLL(list); iterValidLL(&iterator); iterNextLL(&iterator)){
+        TEST_ASSERT_EQUAL_INT_MESSAGE(count, ((TestStruct*)iterGetLL(&iterator))->num, "forward iteration out of order");
+        TEST_ASSERT_EQUAL_INT_MESSAGE(count, iterator.index, "iterator index incorrect");
+        count++;
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(10, count, "forward iteration missed items");
+    for(iterator = iterEndLL(list); iterValidLL(&iterator); iterPrevLL(&iterator)){
+        count--;
+        TEST_ASSERT_EQUAL_INT_MESSAGE(count, ((TestStruct*)iterGetLL(&iterator))->num, "backward iteration out of order");
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, count, "backward iteration missed items");
+    TEST_ASSERT_NULL_MESSAGE(iterGetLL(&iterator), "invalid iterator returned data");
+    destroyLinkedList(list);
+}
+
+/*
+ * Test: test_iterator_remove_insert
+ * ----------------------------
+ * Test that removing and inserting through an iterator keeps the list
+ *      and the iterator consistent.
+ */
+void test_iterator_remove_insert(void){
+    LinkedList * list = createLinkedList(&destroyFunc, &compareFunc);
+    LinkedListIterator iterator;
+    char errorString[100];
+    for(int i = 0; i < 10; i++){
+        addToBackLL(list, createTestingStruct(i, 'a'));
+    }
+    iterator = iterBeginLL(list);
+    while(iterValidLL(&iterator)){
+        TestStruct * test = iterGetLL(&iterator);
+        if(test->num % 2 == 0){
+            free(iterRemoveLL(&iterator));
+        }
+        else{
+            iterInsertBeforeLL(&iterator, createTestingStruct(test->num * 10, 'b'));
+            iterNextLL(&iterator);
+        }
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, iterInsertBeforeLL(&iterator, createTestingStruct(100, 'c')), "insert at end failed");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(11, list->length, "length incorrect after iterator changes");
+    int expected[] = {10, 1, 30, 3, 50, 5, 70, 7, 90, 9, 100};
+    for(int i = 0; i < 11; i++){
+        sprintf(errorString, "wrong item at index %d", i);
+        TEST_ASSERT_EQUAL_INT_MESSAGE(expected[i], ((TestStruct*)getLL(list, i))->num, errorString);
+    }
+    iterator = iterEndLL(list);
+    for(int i = 10; i >= 0; i--){
+        TEST_ASSERT_EQUAL_INT_MESSAGE(expected[i], ((TestStruct*)iterGetLL(&iterator))->num, "back links incorrect after iterator changes");
+        iterPrevLL(&iterator);
+    }
+    iterator = iterEndLL(list);
+    free(iterRemoveLL(&iterator));
+    TEST_ASSERT_EQUAL_INT_MESSAGE(9, ((TestStruct*)list->tail->data)->num, "tail not updated after removing the last item");
+    destroyLinkedList(list);
+}
+
+unsigned long hashFunc(void * data){
+    return ((TestStruct*)data)->num * 2654435761ul;
+}
+
+/*
+ * Function: scanForIndex
+ * ----------------------------
+ * returns the index of the first item equal to data found by walking the
+ *      list.  -1 if there is none.
+ */
+int scanForIndex(LinkedList * list, void * data){
+    int index = 0;
+    for(LinkedListNode * node = list->head; node != NULL; node = node->prev, index++){
+        if(compareFunc(data, node->data) == 0){
+            return index;
+        }
+    }
+    return -1;
+}
+
+/*
+ * Test: test_hash_index_against_scan
+ * ----------------------------
+ * Test searchLL and containsLL on a hash indexed list with duplicates
+ *      against a sequential scan while items are added, inserted, removed
+ *      and sorted.
+ */
+void test_hash_index_against_scan(void){
+    LinkedList * list = createPooledLinkedList(&destroyFunc, &compareFunc, 16);
+    TestStruct * key = createTestingStruct(0, 'a');
+    unsigned int seed = 31;
+    char errorString[100];
+    for(int i = 0; i < 50; i++){
+        addToBackLL(list, createTestingStruct(i % 40, 'a'));
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, enableHashIndexLL(list, &hashFunc), "enableHashIndexLL failed");
+    for(int step = 0; step < 5000; step++){
+        seed = seed * 1103515245 + 12345;
+        int op = (seed >> 8) % 8;
+        int value = (seed >> 16) % 300;
+        if(op == 0){
+            addToFrontLL(list, createTestingStruct(value, 'b'));
+        }
+        else if(op == 1){
+            addToBackLL(list, createTestingStruct(value, 'c'));
+        }
+        else if(op == 2){
+            insertAtIndexLL(list, createTestingStruct(value, 'd'), value % (list->length + 1));
+        }
+        else if(op == 3 && list->length > 0){
+            int index = (seed >> 4) % 3 == 0 ? 0 : (seed >> 4) % 3 == 1 ? list->length - 1 : value % list->length;
+            free(removeFromIndexLL(list, index));
+        }
+        else if(op == 4 && step % 500 == 4){
+            sortLL(list);
+        }
+        else{
+            key->num = value;
+            int expected = scanForIndex(list, key);
+            sprintf(errorString, "searchLL disagrees with a scan at step %d", step);
+            TEST_ASSERT_EQUAL_INT_MESSAGE(expected, searchLL(list, key), errorString);
+            sprintf(errorString, "containsLL disagrees with a scan at step %d", step);
+            TEST_ASSERT_EQUAL_INT_MESSAGE(expected >= 0, containsLL(list, key), errorString);
+        }
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(list->length, list->hashIndex->count, "hash index count out of sync");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, disableHashIndexLL(list), "disableHashIndexLL failed");
+    TEST_ASSERT_NULL_MESSAGE(list->hashIndex, "hash index not removed");
+    key->num = ((TestStruct*)getLL(list, list->length / 2))->num;
+    TEST_ASSERT_EQUAL_INT_MESSAGE(scanForIndex(list, key), searchLL(list, key), "search after disabling failed");
+    free(key);
+    destroyLinkedList(list);
+}
+
+/*
+ * Test: test_hash_index_null
+ * ----------------------------
+ * Test that the hash index functions handle NULL arguments.
+ */
+void test_hash_index_null(void){
+    LinkedList * list = createLinkedList(&destroyFunc, &compareFunc);
+    TEST_ASSERT_EQUAL_INT(0, enableHashIndexLL(NULL, &hashFunc));
+    TEST_ASSERT_EQUAL_INT(0, enableHashIndexLL(list, NULL));
+    TEST_ASSERT_EQUAL_INT(0, disableHashIndexLL(NULL));
+    TEST_ASSERT_EQUAL_INT(0, containsLL(NULL, NULL));
+    TestStruct * test = createTestingStruct(1, 'a');
+    TEST_ASSERT_EQUAL_INT(1, enableHashIndexLL(list, &hashFunc));
+    TEST_ASSERT_EQUAL_INT(-1, searchLL(list, test));
+    TEST_ASSERT_EQUAL_INT(0, containsLL(list, test));
+    free(test);
+    destroyLinkedList(list);
+}
+
+/*
+ * Function: checkList
+ * ----------------------------
+ * checks the nums of a list against an array, walking the list from both
+ *      ends, and that the sorted flag is not set on an unsorted list.
+ */
+void checkList(LinkedList * list, int * expected, int length, char * message){
+    LinkedListNode * node = list->head;
+    TEST_ASSERT_EQUAL_INT_MESSAGE(length, list->length, message);
+    for(int i = 0; i < length; i++, node = node->prev){
+        TEST_ASSERT_NOT_NULL_MESSAGE(node, message);
+        TEST_ASSERT_EQUAL_INT_MESSAGE(expected[i], ((TestStruct*)node->data)->num, message);
+        if(i > 0 && list->sorted){
+            TEST_ASSERT_MESSAGE(expected[i - 1] <= expected[i], message);
+        }
+    }
+    TEST_ASSERT_NULL_MESSAGE(node, message);
+    node = list->tail;
+    for(int i = length - 1; i >= 0; i--, node = node->next){
+        TEST_ASSERT_NOT_NULL_MESSAGE(node, message);
+        TEST_ASSERT_EQUAL_INT_MESSAGE(expected[i], ((TestStruct*)node->data)->num, message);
+    }
+    TEST_ASSERT_NULL_MESSAGE(node, message);
+}
+
+/*
+ * Test: test_concat_split
+ * ----------------------------
+ * Test that concatLL and splitAtLL relink the nodes and keep the sorted
+ *      flag, and that lists split from a pooled list share its pool.
+ */
+void test_concat_split(void){
+    LinkedList * a = createLinkedList(&destroyFunc, &compareFunc);
+    LinkedList * b = createLinkedList(&destroyFunc, &compareFunc);
+    LinkedList * rest;
+    int expected[20];
+    for(int i = 0; i < 20; i++){
+        expected[i] = i;
+        addToBackLL(i < 10 ? a : b, createTestingStruct(i, 'a'));
+    }
+    sortLL(a);
+    sortLL(b);
+    LinkedListNode * head = b->head;
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, concatLL(NULL, b), "concatLL did not fail on NULL list");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, concatLL(a, a), "concatLL did not fail on the same list");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, concatLL(a, b), "concatLL failed");
+    checkList(a, expected, 20, "list incorrect after concatLL");
+    checkList(b, expected, 0, "appended list not empty after concatLL");
+    LinkedListNode * node = a->head;
+    for(int i = 0; i < 10; i++){
+        node = node->prev;
+    }
+    TEST_ASSERT_MESSAGE(node == head, "concatLL did not keep the nodes");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, a->sorted, "concatLL cleared the sorted flag of sorted lists");
+
+    TEST_ASSERT_NULL_MESSAGE(splitAtLL(a, 21), "splitAtLL did not fail out of bounds");
+    rest = splitAtLL(a, 5);
+    TEST_ASSERT_NOT_NULL_MESSAGE(rest, "splitAtLL failed");
+    checkList(a, expected, 5, "list incorrect after splitAtLL");
+    checkList(rest, expected + 5, 15, "new list incorrect after splitAtLL");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, rest->sorted, "splitAtLL did not keep the sorted flag");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, concatLL(rest, a), "concatLL failed");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, rest->sorted, "concatLL kept the sorted flag of out of order lists");
+    destroyLinkedList(rest);
+    destroyLinkedList(b);
+    destroyLinkedList(a);
+
+    a = createPooledLinkedList(&destroyFunc, &compareFunc, 4);
+    for(int i = 0; i < 20; i++){
+        addToBackLL(a, createTestingStruct(i, 'a'));
+    }
+    rest = splitAtLL(a, 0);
+    checkList(a, expected, 0, "list not empty after splitAtLL at zero");
+    checkList(rest, expected, 20, "new list incorrect after splitAtLL at zero");
+    TEST_ASSERT_MESSAGE(rest->pool == a->pool && a->pool->users == 2, "splitAtLL did not share the pool");
+    destroyLinkedList(a);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, rest->pool->users, "pool users not updated on destroy");
+    addToFrontLL(rest, createTestingStruct(-1, 'a'));
+    TEST_ASSERT_EQUAL_INT_MESSAGE(-1, ((TestStruct*)getLL(rest, 0))->num, "shared pool unusable after destroying a user");
+    destroyLinkedList(rest);
+}
+
+/*
+ * Test: test_splice_against_model
+ * ----------------------------
+ * Test random spliceLL calls between an unpooled list with a hash index, a
+ *      pooled list and a list sharing its pool against arrays.
+ */
+void test_splice_against_model(void){
+    LinkedList * lists[3];
+    int model[3][300];
+    int lengths[3] = {0, 0, 0};
+    int moved[300];
+    unsigned int seed = 7;
+    char errorString[100];
+    TestStruct * key = createTestingStruct(0, 'a');
+    lists[0] = createLinkedList(&destroyFunc, &compareFunc);
+    lists[1] = createPooledLinkedList(&destroyFunc, &compareFunc, 8);
+    enableHashIndexLL(lists[0], &hashFunc);
+    for(int i = 0; i < 60; i++){
+        addToBackLL(lists[i % 2], createTestingStruct(i, 'a'));
+        model[i % 2][lengths[i % 2]++] = i;
+    }
+    lists[2] = splitAtLL(lists[1], 10);
+    lengths[2] = lengths[1] - 10;
+    memcpy(model[2], model[1] + 10, sizeof(int) * lengths[2]);
+    lengths[1] = 10;
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, spliceLL(lists[0], 0, lists[0], 0, 1), "spliceLL did not fail on the same list");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, spliceLL(lists[0], 0, lists[1], 5, 6), "spliceLL did not fail out of bounds");
+
+    for(int step = 0; step < 2000; step++){
+        seed = seed * 1103515245 + 12345;
+        int from = (seed >> 8) % 3;
+        int to = (from + 1 + (seed >> 12) % 2) % 3;
+        int first = lengths[from] == 0 ? 0 : (seed >> 16) % (lengths[from] + 1);
+        int count = (seed >> 20) % (lengths[from] - first + 1);
+        int index = (seed >> 4) % (lengths[to] + 1);
+        if(step % 100 == 0){
+            sortLL(lists[to]);
+            for(int i = 1; i < lengths[to]; i++){
+                for(int j = i; j > 0 && model[to][j - 1] > model[to][j]; j--){
+                    int temp = model[to][j];
+                    model[to][j] = model[to][j - 1];
+                    model[to][j - 1] = temp;
+                }
+            }
+        }
+        sprintf(errorString, "spliceLL failed at step %d", step);
+        TEST_ASSERT_EQUAL_INT_MESSAGE(1, spliceLL(lists[to], index, lists[from], first, count), errorString);
+        memcpy(moved, model[from] + first, sizeof(int) * count);
+        memmove(model[from] + first, model[from] + first + count, sizeof(int) * (lengths[from] - first - count));
+        lengths[from] -= count;
+        memmove(model[to] + index + count, model[to] + index, sizeof(int) * (lengths[to] - index));
+        memcpy(model[to] + index, moved, sizeof(int) * count);
+        lengths[to] += count;
+        for(int i = 0; i < 3; i++){
+            sprintf(errorString, "list %d incorrect after spliceLL at step %d", i, step);
+            checkList(lists[i], model[i], lengths[i], errorString);
+        }
+        key->num = (seed >> 3) % 60;
+        sprintf(errorString, "hash index disagrees with a scan at step %d", step);
+        TEST_ASSERT_EQUAL_INT_MESSAGE(scanForIndex(lists[0], key), searchLL(lists[0], key), errorString);
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(lists[0]->length, lists[0]->hashIndex->count, "hash index count out of sync");
+    free(key);
+    for(int i = 0; i < 3; i++){
+        destroyLinkedList(lists[i]);
+    }
+}
+
 int main(void) {
 
     UNITY_BEGIN();
@@ -553,6 +1009,27 @@ int main(void) {
     RUN_TEST(test_get_out_of_upper_bounds);
     RUN_TEST(test_get_even);
     RUN_TEST(test_get_odd);
+
+    //pool tests
+    RUN_TEST(test_create_pooled_linked_list);
+    RUN_TEST(test_pooled_node_reuse);
+    RUN_TEST(test_pooled_large_list);
+
+    //cursor tests
+    RUN_TEST(test_cursor_sequential_get);
+    RUN_TEST(test_cursor_after_mutations);
+
+    //iterator tests
+    RUN_TEST(test_iterator_walk);
+    RUN_TEST(test_iterator_remove_insert);
+
+    //hash index tests
+    RUN_TEST(test_hash_index_against_scan);
+    RUN_TEST(test_hash_index_null);
+
+    //splice tests
+    RUN_TEST(test_concat_split);
+    RUN_TEST(test_splice_against_model);
     
 
     return UNITY_END();
@@ -1,5 +1,5 @@
 #include "unity.h"
-#include "LinkedList.h"
+#include "linkedList.h"
 /*
  * Struct: TestStruct
  * ----------------------------
@@ -408,6 +408,343 @@ void test_sort_one_item(void){
     destroyLinkedList(list);
 }
 
+/*
+ * Function: checkSortedLinks
+ * ----------------------------
+ * Asserts a list is in non-decreasing order walking from the head and that
+ *      walking back from the tail visits the same nodes.
+ */
+void checkSortedLinks(LinkedList * list){
+    LinkedListNode * node = list->head;
+    LinkedListNode * last = NULL;
+    int count = 0;
+    TEST_ASSERT_NULL_MESSAGE(list->head->next, "head has a next node");
+    while(node != NULL){
+        if(last != NULL){
+            TEST_ASSERT_MESSAGE(compareFunc(last->data, node->data) <= 0, "list out of order after sort");
+            TEST_ASSERT_MESSAGE(node->next == last, "next pointer does not point back to the previous node");
+        }
+        last = node;
+        node = node->prev;
+        count++;
+    }
+    TEST_ASSERT_MESSAGE(list->tail == last, "tail does not point to the last node");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(list->length, count, "sort lost or duplicated nodes");
+}
+
+/*
+ * Test: test_sort_random
+ * ----------------------------
+ * Test the the sortLL function using a large list in pseudo random order
+ *      containing runs and duplicates.
+ */
+void test_sort_random(void){
+    LinkedList * list = createLinkedList(&destroyFunc, &compareFunc);
+    unsigned int seed = 12345;
+    for(int i = 0; i < 5000; i++){
+        seed = seed * 1103515245 + 12345;
+        addToBackLL(list, createTestingStruct((seed >> 16) % 1000, 'a' + (seed >> 8) % 3));
+    }
+    sortLL(list);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, list->sorted, "sorted flag was not set to 1 after sorting");
+    checkSortedLinks(list);
+    destroyLinkedList(list);
+}
+
+int compareNumOnly(void * a, void * b){
+    return ((TestStruct*)a)->num - ((TestStruct*)b)->num;
+}
+
+unsigned long hashNum(void * data){
+    return ((TestStruct*)data)->num * 2654435761ul;
+}
+
+/*
+ * Test: test_sort_stable
+ * ----------------------------
+ * Test that sortLL keeps equal items in their original order.
+ */
+void test_sort_stable(void){
+    LinkedList * list = createLinkedList(&destroyFunc, &compareNumOnly);
+    char errorString[100];
+    for(int i = 0; i < 300; i++){
+        addToBackLL(list, createTestingStruct((i * 7) % 5, 'a' + i / 20));
+    }
+    sortLL(list);
+    LinkedListNode * node = list->head;
+    while(node->prev != NULL){
+        TestStruct * a = node->data;
+        TestStruct * b = node->prev->data;
+        sprintf(errorString, "unstable at %d%c, %d%c", a->num, a->letter, b->num, b->letter);
+        TEST_ASSERT_MESSAGE(a->num < b->num || (a->num == b->num && a->letter <= b->letter), errorString);
+        node = node->prev;
+    }
+    destroyLinkedList(list);
+}
+
+/*
+ * Test: test_sort_pooled
+ * ----------------------------
+ * Test that sorting a pooled list does not take nodes from the pool.
+ */
+void test_sort_pooled(void){
+    LinkedList * list = createPooledLinkedList(&destroyFunc, &compareFunc, 8);
+    for(int i = 0; i < 8; i++){
+        addToFrontLL(list, createTestingStruct(i % 3, 'a' + i));
+    }
+    TEST_ASSERT_NULL_MESSAGE(list->pool->freeNodes, "pool not exhausted before sort");
+    sortLL(list);
+    TEST_ASSERT_NULL_MESSAGE(list->pool->freeNodes, "sort took a node from the pool");
+    TEST_ASSERT_NULL_MESSAGE(list->pool->slabs->next, "sort grew the pool");
+    checkSortedLinks(list);
+    destroyLinkedList(list);
+}
+
+/*
+ * Test: test_sort_parallel
+ * ----------------------------
+ * Test sortLL on several threads for thread counts that do and do not
+ *      divide the list evenly, and that it stays stable.
+ */
+void test_sort_parallel(void){
+    char errorString[100];
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, setSortThreadsLL(NULL, 2, 0), "setSortThreadsLL did not fail on NULL list");
+    for(int threads = 1; threads <= 9; threads += 2){
+        LinkedList * list = createLinkedList(&destroyFunc, &compareNumOnly);
+        unsigned int seed = 99 + threads;
+        TEST_ASSERT_EQUAL_INT_MESSAGE(0, setSortThreadsLL(list, 0, 0), "setSortThreadsLL accepted zero threads");
+        TEST_ASSERT_EQUAL_INT_MESSAGE(0, setSortThreadsLL(list, LL_MAX_SORT_THREADS + 1, 0), "setSortThreadsLL accepted too many threads");
+        TEST_ASSERT_EQUAL_INT_MESSAGE(1, setSortThreadsLL(list, threads, 100), "setSortThreadsLL failed");
+        for(int i = 0; i < 3001; i++){
+            seed = seed * 1103515245 + 12345;
+            addToBackLL(list, createTestingStruct((seed >> 16) % 500, 'a' + i / 120));
+        }
+        sortLL(list);
+        checkSortedLinks(list);
+        for(LinkedListNode * node = list->head; node->prev != NULL; node = node->prev){
+            TestStruct * a = node->data;
+            TestStruct * b = node->prev->data;
+            sprintf(errorString, "unstable on %d threads at %d%c, %d%c", threads, a->num, a->letter, b->num, b->letter);
+            TEST_ASSERT_MESSAGE(a->num < b->num || a->letter <= b->letter, errorString);
+        }
+        destroyLinkedList(list);
+    }
+}
+
+/*
+ * Test: test_array_sort
+ * ----------------------------
+ * Test that arraySortLL sorts stably without relinking the nodes and keeps
+ *      a hash index in step with the moved data.
+ */
+void test_array_sort(void){
+    LinkedList * list = createPooledLinkedList(&destroyFunc, &compareNumOnly, 16);
+    TestStruct * key = createTestingStruct(0, 'a');
+    unsigned int seed = 4321;
+    char errorString[100];
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, arraySortLL(NULL), "arraySortLL did not fail on NULL list");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, arraySortLL(list), "arraySortLL failed on an empty list");
+    for(int i = 0; i < 2000; i++){
+        seed = seed * 1103515245 + 12345;
+        addToBackLL(list, createTestingStruct((seed >> 16) % 300, 'a' + i / 100));
+    }
+    enableHashIndexLL(list, &hashNum);
+    enableSkipIndexLL(list);
+    LinkedListNode * head = list->head;
+    LinkedListNode * tail = list->tail;
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, arraySortLL(list), "arraySortLL failed");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, list->sorted, "sorted flag was not set to 1 after sorting");
+    TEST_ASSERT_MESSAGE(list->head == head && list->tail == tail, "arraySortLL relinked the nodes");
+    checkSortedLinks(list);
+    for(LinkedListNode * node = list->head; node->prev != NULL; node = node->prev){
+        TestStruct * a = node->data;
+        TestStruct * b = node->prev->data;
+        sprintf(errorString, "unstable at %d%c, %d%c", a->num, a->letter, b->num, b->letter);
+        TEST_ASSERT_MESSAGE(a->num < b->num || a->letter <= b->letter, errorString);
+    }
+    for(int i = 0; i < 300; i += 11){
+        key->num = i;
+        int index = searchLL(list, key);
+        sprintf(errorString, "hash index incorrect after arraySortLL for %d", i);
+        TEST_ASSERT_MESSAGE(index == -1 || ((TestStruct*)getLL(list, index))->num == i, errorString);
+        TEST_ASSERT_MESSAGE(index <= 0 || ((TestStruct*)getLL(list, index - 1))->num < i, errorString);
+    }
+    disableHashIndexLL(list);
+    for(int i = 0; i < 300; i += 13){
+        key->num = i;
+        int index = searchLL(list, key);
+        sprintf(errorString, "skip index incorrect after arraySortLL for %d", i);
+        TEST_ASSERT_MESSAGE(index == -1 || ((TestStruct*)getLL(list, index))->num == i, errorString);
+        TEST_ASSERT_MESSAGE(index <= 0 || ((TestStruct*)getLL(list, index - 1))->num < i, errorString);
+    }
+    free(key);
+    destroyLinkedList(list);
+}
+
+/*
+ * Test: test_merge_sorted
+ * ----------------------------
+ * Test that mergeSortedLL merges two sorted lists in order and stably,
+ *      leaving the second empty, and refuses unsorted lists.
+ */
+void test_merge_sorted(void){
+    LinkedList * dest = createLinkedList(&destroyFunc, &compareNumOnly);
+    LinkedList * src = createPooledLinkedList(&destroyFunc, &compareNumOnly, 8);
+    TestStruct * key = createTestingStruct(0, 'a');
+    for(int i = 0; i < 200; i++){
+        addToBackLL(dest, createTestingStruct(i * 3 / 2, 'a'));
+        addToBackLL(src, createTestingStruct(i * 5 / 4, 'b'));
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, mergeSortedLL(dest, src), "mergeSortedLL merged unsorted lists");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, mergeSortedLL(NULL, src), "mergeSortedLL did not fail on NULL list");
+    sortLL(dest);
+    sortLL(src);
+    enableHashIndexLL(dest, &hashNum);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, mergeSortedLL(dest, dest), "mergeSortedLL did not fail on the same list");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, mergeSortedLL(dest, src), "mergeSortedLL failed");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(400, dest->length, "length incorrect after merge");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, dest->sorted, "sorted flag cleared by merge");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, src->length, "merged list not emptied");
+    TEST_ASSERT_NULL_MESSAGE(src->head, "merged list head not cleared");
+    checkSortedLinks(dest);
+    LinkedListNode * node = dest->head;
+    while(node->prev != NULL){
+        TestStruct * a = node->data;
+        TestStruct * b = node->prev->data;
+        TEST_ASSERT_MESSAGE(a->num < b->num || a->letter <= b->letter, "merge placed an item of src before an equal item of dest");
+        node = node->prev;
+    }
+    for(int i = 0; i < 300; i += 7){
+        key->num = i;
+        int index = searchLL(dest, key);
+        TEST_ASSERT_MESSAGE(index == -1 || ((TestStruct*)getLL(dest, index))->num == i, "hash index incorrect after merge");
+        TEST_ASSERT_MESSAGE(index <= 0 || ((TestStruct*)getLL(dest, index - 1))->num < i, "search did not find the first match after merge");
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, mergeSortedLL(src, dest), "mergeSortedLL into an empty list failed");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(400, src->length, "length incorrect after merge into an empty list");
+    checkSortedLinks(src);
+    free(key);
+    destroyLinkedList(dest);
+    destroyLinkedList(src);
+}
+
+/*
+ * Function: checkSkipIndex
+ * ----------------------------
+ * Asserts every entry of a built skip index refers to a node of the list
+ *      and that the spans on every level match the node indexes.
+ */
+void checkSkipIndex(LinkedList * list){
+    LinkedListSkipIndex * skipIndex = list->skipIndex;
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, skipIndex->built, "skip index not built");
+    for(int i = 0; i < skipIndex->level; i++){
+        LinkedListSkipNode * skipNode = skipIndex->header;
+        int position = -1;
+        while(skipNode->levels[i].next != NULL){
+            position += skipNode->levels[i].span;
+            skipNode = skipNode->levels[i].next;
+            LinkedListNode * node = list->head;
+            int index = 0;
+            while(node != NULL && node != skipNode->node){
+                node = node->prev;
+                index++;
+            }
+            TEST_ASSERT_NOT_NULL_MESSAGE(node, "skip entry refers to a node not in the list");
+            TEST_ASSERT_EQUAL_INT_MESSAGE(index, position, "skip span does not match the node index");
+        }
+    }
+}
+
+/*
+ * Test: test_skip_index_against_scan
+ * ----------------------------
+ * Test searchLL, insertSortedLL and removeFromIndexLL on a skip indexed list
+ *      with many equal items against a sequential scan.
+ */
+void test_skip_index_against_scan(void){
+    LinkedList * list = createLinkedList(&destroyFunc, &compareNumOnly);
+    TestStruct * key = createTestingStruct(0, 'a');
+    unsigned int seed = 2024;
+    char errorString[100];
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, enableSkipIndexLL(list), "enableSkipIndexLL failed");
+    for(int i = 0; i < 500; i++){
+        seed = seed * 1103515245 + 12345;
+        addToBackLL(list, createTestingStruct((seed >> 16) % 400, 'a'));
+    }
+    sortLL(list);
+    for(int step = 0; step < 3000; step++){
+        seed = seed * 1103515245 + 12345;
+        int op = (seed >> 8) % 3;
+        int value = (seed >> 16) % 400;
+        if(op == 0){
+            TestStruct * test = createTestingStruct(value, 'b');
+            int index = insertSortedLL(list, test);
+            sprintf(errorString, "insertSortedLL returned the wrong index at step %d", step);
+            TEST_ASSERT_MESSAGE(getLL(list, index) == test, errorString);
+            TEST_ASSERT_MESSAGE(index + 1 == list->length || compareNumOnly(getLL(list, index + 1), test) > 0, "inserted before an equal item");
+        }
+        else if(op == 1 && list->length > 0){
+            free(removeFromIndexLL(list, value % list->length));
+        }
+        else{
+            int expected = -1;
+            int count = 0;
+            key->num = value;
+            for(LinkedListNode * node = list->head; node != NULL; node = node->prev, count++){
+                if(compareNumOnly(node->data, key) == 0){
+                    expected = count;
+                    break;
+                }
+            }
+            sprintf(errorString, "searchLL disagrees with a scan at step %d", step);
+            TEST_ASSERT_EQUAL_INT_MESSAGE(expected, searchLL(list, key), errorString);
+        }
+        if(step % 500 == 0){
+            checkSkipIndex(list);
+        }
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, list->sorted, "list no longer marked sorted");
+    checkSkipIndex(list);
+    checkSortedLinks(list);
+    free(key);
+    destroyLinkedList(list);
+}
+
+/*
+ * Test: test_skip_index_dropped
+ * ----------------------------
+ * Test that unsorted inserts and sortLL drop the skip index and that it
+ *      is rebuilt by the next search.
+ */
+void test_skip_index_dropped(void){
+    LinkedList * list = createLinkedList(&destroyFunc, &compareFunc);
+    TestStruct * key = createTestingStruct(3, 'a');
+    enableSkipIndexLL(list);
+    for(int i = 0; i < 100; i++){
+        insertSortedLL(list, createTestingStruct(i, 'a'));
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, list->skipIndex->built, "insertSortedLL did not build the index");
+    checkSkipIndex(list);
+
+    addToFrontLL(list, createTestingStruct(500, 'a'));
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, list->sorted, "list still marked sorted");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, list->skipIndex->built, "unsorted insert did not drop the index");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(4, searchLL(list, key), "unsorted search failed");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, list->skipIndex->built, "index built on an unsorted list");
+
+    sortLL(list);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, list->skipIndex->built, "index built before it was needed");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(3, searchLL(list, key), "indexed search failed");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, list->skipIndex->built, "search did not rebuild the index");
+    checkSkipIndex(list);
+
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, disableSkipIndexLL(list), "disableSkipIndexLL failed");
+    TEST_ASSERT_NULL_MESSAGE(list->skipIndex, "index not removed");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(3, searchLL(list, key), "search after disabling failed");
+    free(key);
+    destroyLinkedList(list);
+}
+
 void setUp(void) {
     // set stuff up here
 
@@ -443,6 +780,16 @@ int main(void) {
     RUN_TEST(test_sort_null);
     RUN_TEST(test_sort_empty);
     RUN_TEST(test_sort_one_item);
+    RUN_TEST(test_sort_random);
+    RUN_TEST(test_sort_stable);
+    RUN_TEST(test_sort_pooled);
+    RUN_TEST(test_sort_parallel);
+    RUN_TEST(test_array_sort);
+    RUN_TEST(test_merge_sorted);
+
+    //skip index tests
+    RUN_TEST(test_skip_index_against_scan);
+    RUN_TEST(test_skip_index_dropped);
 
     return UNITY_END();
 }
\ No newline at end of file
@@ -0,0 +1,211 @@
+#include <stdio.h>
+#include <string.h>
+#include "unity.h"
+#include "typedLinkedList.h"
+
+/*
+ * Struct: Point
+ * ----------------------------
+ * A struct stored by value in a typed list.  Points are ordered by x only
+ *      so the sort can be checked for stability using y.
+ */
+typedef struct point{
+    int x;
+    int y;
+}Point;
+
+#define comparePoints(a, b) LL_COMPARE_VALUES((a).x, (b).x)
+
+DEFINE_LINKED_LIST(IntList, int, LL_COMPARE_VALUES)
+DEFINE_LINKED_LIST(PointList, Point, comparePoints)
+
+void setUp(void) {
+    // set stuff up here
+
+}
+
+void tearDown(void) {
+    // clean stuff up here
+}
+
+/*
+ * Function: checkIntList
+ * ----------------------------
+ * checks an IntList against an array, walking the list from both ends.
+ */
+void checkIntList(IntList * list, int * expected, int length, char * message){
+    IntListNode * node = list->head;
+    TEST_ASSERT_EQUAL_INT_MESSAGE(length, list->length, message);
+    for(int i = 0; i < length; i++, node = node->prev){
+        TEST_ASSERT_NOT_NULL_MESSAGE(node, message);
+        TEST_ASSERT_EQUAL_INT_MESSAGE(expected[i], node->value, message);
+    }
+    TEST_ASSERT_NULL_MESSAGE(node, message);
+    node = list->tail;
+    for(int i = length - 1; i >= 0; i--, node = node->next){
+        TEST_ASSERT_NOT_NULL_MESSAGE(node, message);
+        TEST_ASSERT_EQUAL_INT_MESSAGE(expected[i], node->value, message);
+    }
+    TEST_ASSERT_NULL_MESSAGE(node, message);
+}
+
+/*
+ * Test: test_typed_null
+ * ----------------------------
+ * Test that the typed list functions handle NULL lists and bad indexes.
+ */
+void test_typed_null(void){
+    IntList * list = createIntList();
+    int value = 5;
+    TEST_ASSERT_NOT_NULL_MESSAGE(list, "createIntList returned NULL");
+    TEST_ASSERT_EQUAL_INT(0, addToFrontIntList(NULL, 1));
+    TEST_ASSERT_EQUAL_INT(0, addToBackIntList(NULL, 1));
+    TEST_ASSERT_EQUAL_INT(0, insertAtIndexIntList(list, 1, 1));
+    TEST_ASSERT_EQUAL_INT(0, insertAtIndexIntList(list, 1, -1));
+    TEST_ASSERT_EQUAL_INT(0, removeFromIndexIntList(list, 0, &value));
+    TEST_ASSERT_EQUAL_INT_MESSAGE(5, value, "failed remove changed the value");
+    TEST_ASSERT_NULL(getIntList(list, 0));
+    TEST_ASSERT_NULL(getIntList(NULL, 0));
+    TEST_ASSERT_EQUAL_INT(-1, searchIntList(list, 1));
+    TEST_ASSERT_EQUAL_INT(-1, insertSortedIntList(NULL, 1));
+    TEST_ASSERT_EQUAL_INT(0, sortIntList(NULL));
+    TEST_ASSERT_EQUAL_INT(0, destroyIntList(NULL));
+    TEST_ASSERT_EQUAL_INT(1, destroyIntList(list));
+}
+
+/*
+ * Test: test_typed_against_model
+ * ----------------------------
+ * Test random adds, inserts, removes, gets and searches on an IntList
+ *      against an array.
+ */
+void test_typed_against_model(void){
+    IntList * list = createIntList();
+    int model[3000];
+    int length = 0;
+    int value;
+    unsigned int seed = 77;
+    char errorString[100];
+    for(int step = 0; step < 3000; step++){
+        seed = seed * 1103515245 + 12345;
+        int op = (seed >> 8) % 6;
+        int number = (seed >> 16) % 500;
+        if(op == 0){
+            addToFrontIntList(list, number);
+            memmove(model + 1, model, sizeof(int) * length);
+            model[0] = number;
+            length++;
+        }
+        else if(op == 1){
+            addToBackIntList(list, number);
+            model[length++] = number;
+        }
+        else if(op == 2){
+            int index = number % (length + 1);
+            insertAtIndexIntList(list, number, index);
+            memmove(model + index + 1, model + index, sizeof(int) * (length - index));
+            model[index] = number;
+            length++;
+        }
+        else if(op == 3 && length > 0){
+            int index = number % length;
+            TEST_ASSERT_EQUAL_INT(1, removeFromIndexIntList(list, index, &value));
+            sprintf(errorString, "removed the wrong value at step %d", step);
+            TEST_ASSERT_EQUAL_INT_MESSAGE(model[index], value, errorString);
+            memmove(model + index, model + index + 1, sizeof(int) * (length - index - 1));
+            length--;
+        }
+        else if(op == 4 && length > 0){
+            int index = number % length;
+            sprintf(errorString, "get returned the wrong value at step %d", step);
+            TEST_ASSERT_EQUAL_INT_MESSAGE(model[index], *getIntList(list, index), errorString);
+        }
+        else{
+            int expected = -1;
+            for(int i = 0; i < length; i++){
+                if(model[i] == number){
+                    expected = i;
+                    break;
+                }
+            }
+            sprintf(errorString, "search disagrees with a scan at step %d", step);
+            TEST_ASSERT_EQUAL_INT_MESSAGE(expected, searchIntList(list, number), errorString);
+        }
+    }
+    checkIntList(list, model, length, "list incorrect after random operations");
+    destroyIntList(list);
+}
+
+/*
+ * Test: test_typed_sorted
+ * ----------------------------
+ * Test sort, insertSorted and search on a sorted IntList, including the
+ *      early exit of search on a sorted list.
+ */
+void test_typed_sorted(void){
+    IntList * list = createIntList();
+    int expected[1000];
+    unsigned int seed = 5;
+    for(int i = 0; i < 500; i++){
+        seed = seed * 1103515245 + 12345;
+        addToBackIntList(list, (seed >> 16) % 1000);
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(-1, insertSortedIntList(list, 3), "insertSorted on an unsorted list succeeded");
+    TEST_ASSERT_EQUAL_INT(1, sortIntList(list));
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, list->sorted, "sorted flag not set after sort");
+    for(int i = 0; i < 500; i++){
+        seed = seed * 1103515245 + 12345;
+        int value = (seed >> 16) % 1000;
+        int index = insertSortedIntList(list, value);
+        TEST_ASSERT_EQUAL_INT_MESSAGE(value, *getIntList(list, index), "insertSorted returned the wrong index");
+    }
+    int length = 0;
+    for(IntListNode * node = list->head; node != NULL; node = node->prev){
+        expected[length++] = node->value;
+    }
+    for(int i = 1; i < length; i++){
+        TEST_ASSERT_MESSAGE(expected[i - 1] <= expected[i], "list out of order after sort and insertSorted");
+    }
+    checkIntList(list, expected, 1000, "links incorrect after sort");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(-1, searchIntList(list, 1000), "found a value larger than every item");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, searchIntList(list, expected[0]), "did not find the first item");
+    destroyIntList(list);
+}
+
+/*
+ * Test: test_typed_struct_sort_stable
+ * ----------------------------
+ * Test that a list of structs stored by value sorts stably.
+ */
+void test_typed_struct_sort_stable(void){
+    PointList * list = createPointList();
+    Point point;
+    for(int i = 0; i < 300; i++){
+        point.x = (i * 7) % 5;
+        point.y = i;
+        addToBackPointList(list, point);
+    }
+    sortPointList(list);
+    for(PointListNode * node = list->head; node->prev != NULL; node = node->prev){
+        Point a = node->value;
+        Point b = node->prev->value;
+        TEST_ASSERT_MESSAGE(a.x < b.x || (a.x == b.x && a.y < b.y), "struct sort unstable");
+    }
+    getPointList(list, 0)->y = -1;
+    TEST_ASSERT_EQUAL_INT_MESSAGE(-1, list->head->value.y, "get did not return the value inside the node");
+    point.x = 3;
+    TEST_ASSERT_EQUAL_INT_MESSAGE(180, searchPointList(list, point), "search by the compared field failed");
+    destroyPointList(list);
+}
+
+int main(void) {
+
+    UNITY_BEGIN();
+
+    RUN_TEST(test_typed_null);
+    RUN_TEST(test_typed_against_model);
+    RUN_TEST(test_typed_sorted);
+    RUN_TEST(test_typed_struct_sort_stable);
+
+    return UNITY_END();
+}
@@ -0,0 +1,238 @@
+#include "unity.h"
+#include <string.h>
+#include "unrolledList.h"
+/*
+ * Struct: TestStruct
+ * ----------------------------
+ * A data structure used for testing
+ */
+typedef struct testingStruct{
+    int num;
+    char letter;
+}TestStruct;
+
+/*
+ * Function: createTestingStruct
+ * ----------------------------
+ * Allocates and sets a structure used for testing the UnrolledList data structure.
+ * 
+ * Created to keep DRY (Don't Repeated Yourself)
+ */
+TestStruct * createTestingStruct(int num, char c){
+    TestStruct * test = malloc(sizeof(TestStruct));
+    test->num = num;
+    test->letter = c;
+    return test;
+}
+
+void destroyFunc(void * data){
+    free(data);
+}
+
+int compareFunc(void * a, void * b){
+    return ((TestStruct*)a)->num - ((TestStruct*)b)->num;
+}
+
+void setUp(void) {
+    // set stuff up here
+
+}
+
+void tearDown(void) {
+    // clean stuff up here
+}
+
+/*
+ * Function: checkNodes
+ * ----------------------------
+ * Asserts the node links, counts and length of a list agree.
+ */
+void checkNodes(UnrolledList * list){
+    int length = 0;
+    UnrolledListNode * last = NULL;
+    for(UnrolledListNode * node = list->head; node != NULL; node = node->next){
+        TEST_ASSERT_MESSAGE(node->prev == last, "prev pointer incorrect");
+        TEST_ASSERT_MESSAGE(node->count > 0 && node->count <= UL_NODE_CAPACITY, "node count out of range");
+        length += node->count;
+        last = node;
+    }
+    TEST_ASSERT_MESSAGE(list->tail == last, "tail incorrect");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(list->length, length, "length does not match node counts");
+}
+
+/*
+ * Test: test_create_unrolled_list
+ * ----------------------------
+ * Ensure the createUnrolledList function works as expected
+ */
+void test_create_unrolled_list(void){
+    UnrolledList * list = createUnrolledList(&destroyFunc, &compareFunc);
+    TEST_ASSERT_NOT_NULL_MESSAGE(list, "createUnrolledList returned NULL");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, list->length, "list length not initiliazed to zero");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, list->sorted, "sorted flag did not initialize to one");
+    destroyUnrolledList(list);
+}
+
+/*
+ * Test: test_null_unrolled_list
+ * ----------------------------
+ * Test that every function handles a NULL list gracefully.
+ */
+void test_null_unrolled_list(void){
+    TEST_ASSERT_EQUAL_INT(0, addToFrontUL(NULL, NULL));
+    TEST_ASSERT_EQUAL_INT(0, addToBackUL(NULL, NULL));
+    TEST_ASSERT_EQUAL_INT(0, insertAtIndexUL(NULL, NULL, 0));
+    TEST_ASSERT_NULL(removeFromIndexUL(NULL, 0));
+    TEST_ASSERT_NULL(getUL(NULL, 0));
+    TEST_ASSERT_EQUAL_INT(-1, searchUL(NULL, NULL));
+    TEST_ASSERT_EQUAL_INT(-1, insertSortedUL(NULL, NULL));
+    TEST_ASSERT_EQUAL_INT(0, sortUL(NULL));
+    TEST_ASSERT_EQUAL_INT(0, destroyUnrolledList(NULL));
+}
+
+/*
+ * Test: test_unrolled_against_model
+ * ----------------------------
+ * Test inserts, removes and gets at random indexes against an array
+ *      holding the same items.
+ */
+void test_unrolled_against_model(void){
+    UnrolledList * list = createUnrolledList(&destroyFunc, &compareFunc);
+    TestStruct * model[2000];
+    int length = 0;
+    unsigned int seed = 7;
+    char errorString[100];
+
+    for(int step = 0; step < 20000; step++){
+        seed = seed * 1103515245 + 12345;
+        int op = (seed >> 16) % 6;
+        int index = length == 0 ? 0 : (int)((seed >> 3) % (length + 1));
+        if(op < 2 && length < 2000){
+            TestStruct * test = createTestingStruct(step, 'a');
+            if(op == 0){
+                TEST_ASSERT_EQUAL_INT(1, insertAtIndexUL(list, test, index));
+            }
+            else{
+                index = 0;
+                TEST_ASSERT_EQUAL_INT(1, addToFrontUL(list, test));
+            }
+            memmove(model + index + 1, model + index, sizeof(TestStruct *) * (length - index));
+            model[index] = test;
+            length++;
+        }
+        else if(op == 2 && length < 2000){
+            model[length] = createTestingStruct(step, 'b');
+            addToBackUL(list, model[length]);
+            length++;
+        }
+        else if(op == 3 && length > 0){
+            index %= length;
+            sprintf(errorString, "removed wrong item at step %d", step);
+            TEST_ASSERT_MESSAGE(removeFromIndexUL(list, index) == model[index], errorString);
+            free(model[index]);
+            memmove(model + index, model + index + 1, sizeof(TestStruct *) * (length - index - 1));
+            length--;
+        }
+        else if(length > 0){
+            index %= length;
+            sprintf(errorString, "getUL returned the wrong item at step %d", step);
+            TEST_ASSERT_MESSAGE(getUL(list, index) == model[index], errorString);
+        }
+        if(step % 1000 == 0){
+            checkNodes(list);
+        }
+    }
+    checkNodes(list);
+    for(int i = 0; i < length; i++){
+        sprintf(errorString, "final scan mismatch at %d", i);
+        TEST_ASSERT_MESSAGE(getUL(list, i) == model[i], errorString);
+    }
+    TEST_ASSERT_NULL_MESSAGE(getUL(list, length), "get past the end did not return NULL");
+    destroyUnrolledList(list);
+}
+
+/*
+ * Test: test_unrolled_search
+ * ----------------------------
+ * Test that searchUL finds items in any node and reports missing ones.
+ */
+void test_unrolled_search(void){
+    UnrolledList * list = createUnrolledList(&destroyFunc, &compareFunc);
+    TestStruct * test = createTestingStruct(1000, 'a');
+    for(int i = 0; i < 200; i++){
+        addToBackUL(list, createTestingStruct(i, 'a'));
+    }
+    for(int i = 0; i < 200; i += 17){
+        test->num = i;
+        TEST_ASSERT_EQUAL_INT_MESSAGE(i, searchUL(list, test), "search returned wrong index");
+    }
+    test->num = 1000;
+    TEST_ASSERT_EQUAL_INT_MESSAGE(-1, searchUL(list, test), "search found an absent item");
+    free(test);
+    destroyUnrolledList(list);
+}
+
+/*
+ * Test: test_unrolled_sort
+ * ----------------------------
+ * Test that sortUL sorts stably and keeps the node structure.
+ */
+void test_unrolled_sort(void){
+    UnrolledList * list = createUnrolledList(&destroyFunc, &compareFunc);
+    unsigned int seed = 99;
+    for(int i = 0; i < 1000; i++){
+        seed = seed * 1103515245 + 12345;
+        addToFrontUL(list, createTestingStruct((seed >> 16) % 50, 'a' + i % 26));
+        ((TestStruct*)getUL(list, 0))->letter = i / 40;
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, list->sorted, "list marked sorted");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, sortUL(list), "sort failed");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, list->sorted, "sorted flag not set after sort");
+    checkNodes(list);
+    for(int i = 1; i < 1000; i++){
+        TestStruct * a = getUL(list, i - 1);
+        TestStruct * b = getUL(list, i);
+        TEST_ASSERT_MESSAGE(a->num <= b->num, "list out of order after sort");
+        if(a->num == b->num){
+            TEST_ASSERT_MESSAGE(a->letter >= b->letter, "sort was not stable");
+        }
+    }
+    destroyUnrolledList(list);
+}
+
+/*
+ * Test: test_unrolled_insert_sorted
+ * ----------------------------
+ * Test that insertSortedUL keeps the list in order and reports the index.
+ */
+void test_unrolled_insert_sorted(void){
+    UnrolledList * list = createUnrolledList(&destroyFunc, &compareFunc);
+    unsigned int seed = 5;
+    for(int i = 0; i < 500; i++){
+        seed = seed * 1103515245 + 12345;
+        TestStruct * test = createTestingStruct((seed >> 16) % 300, 'a');
+        int index = insertSortedUL(list, test);
+        TEST_ASSERT_MESSAGE(getUL(list, index) == test, "insertSortedUL returned the wrong index");
+    }
+    checkNodes(list);
+    for(int i = 1; i < 500; i++){
+        TEST_ASSERT_MESSAGE(compareFunc(getUL(list, i - 1), getUL(list, i)) <= 0, "list out of order");
+    }
+    addToFrontUL(list, createTestingStruct(1, 'a'));
+    TEST_ASSERT_EQUAL_INT_MESSAGE(-1, insertSortedUL(list, list->head->data[0]), "insert sorted into unsorted list succeeded");
+    destroyUnrolledList(list);
+}
+
+int main(void) {
+
+    UNITY_BEGIN();
+
+    RUN_TEST(test_create_unrolled_list);
+    RUN_TEST(test_null_unrolled_list);
+    RUN_TEST(test_unrolled_against_model);
+    RUN_TEST(test_unrolled_search);
+    RUN_TEST(test_unrolled_sort);
+    RUN_TEST(test_unrolled_insert_sorted);
+
+    return UNITY_END();
+}
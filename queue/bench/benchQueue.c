@@ -0,0 +1,256 @@
+#include "bench.h"
+#include "queue.h"
+#include "mpmcQueue.h"
+#include "typedQueue.h"
+#include "intrusiveQueue.h"
+#include "blockingQueue.h"
+
+/*
+ * Benchmark: benchQueue
+ * ----------------------------
+ * Measures enqueue and dequeue of the Queue, one at a time and in batches
+ *      of BATCH, of an IntQueue holding the values themselves, of an
+ *      IntrusiveQueue of items that carry their own links, and of the
+ *      MPMCQueue and BlockingQueue from a single thread, for queue lengths from 10 up to 10^7 in powers of ten.
+ *
+ * usage: benchQueue [--csv | --json] [--min size] [--max size]
+ *
+ * output: one row per operation and length, see bench.h.
+ */
+
+#define BATCH 256
+
+DEFINE_QUEUE(IntQueue, int)
+
+typedef struct queueItem{
+    int value;
+    QueueLink link;
+}QueueItem;
+
+typedef struct queueContext{
+    Queue * queue;
+    IntQueue * intQueue;
+    IntrusiveQueue * intrusive;
+    IntrusiveQueue * other;
+    QueueItem * items;
+    MPMCQueue * mpmc;
+    BlockingQueue * blocking;
+    int * values;
+    int ** pointers;
+    long sum;
+}QueueContext;
+
+void noDestroyFunc(void * data){
+}
+
+void noPrintFunc(void * data){
+}
+
+void enqueueBody(void * context, long first, long count){
+    QueueContext * c = context;
+    for(long i = first; i < first + count; i++){
+        enqueue(c->queue, &c->values[i]);
+    }
+}
+
+void dequeueBody(void * context, long first, long count){
+    QueueContext * c = context;
+    for(long i = 0; i < count; i++){
+        dequeue(c->queue);
+    }
+}
+
+/*
+ * Function: enqueueDequeueBody
+ * ----------------------------
+ * one op is an enqueue followed by a dequeue, so the length stays fixed.
+ */
+void enqueueDequeueBody(void * context, long first, long count){
+    QueueContext * c = context;
+    for(long i = first; i < first + count; i++){
+        enqueue(c->queue, &c->values[i]);
+        dequeue(c->queue);
+    }
+}
+
+/*
+ * Function: enqueueBatchBody
+ * ----------------------------
+ * enqueues the values in batches of BATCH.  One op is one item.
+ */
+void enqueueBatchBody(void * context, long first, long count){
+    QueueContext * c = context;
+    for(long i = first; i < first + count; i += BATCH){
+        int batch = first + count - i < BATCH ? first + count - i : BATCH;
+        enqueueBatch(c->queue, (void **)&c->pointers[i], batch);
+    }
+}
+
+void dequeueBatchBody(void * context, long first, long count){
+    QueueContext * c = context;
+    void * items[BATCH];
+    for(long i = 0; i < count; i += BATCH){
+        dequeueBatch(c->queue, items, count - i < BATCH ? count - i : BATCH);
+    }
+}
+
+void intEnqueueBody(void * context, long first, long count){
+    QueueContext * c = context;
+    for(long i = first; i < first + count; i++){
+        enqueueIntQueue(c->intQueue, c->values[i]);
+    }
+}
+
+/*
+ * Function: intDequeueBody
+ * ----------------------------
+ * sums the dequeued values so the compiler cannot drop the loads.
+ */
+void intDequeueBody(void * context, long first, long count){
+    QueueContext * c = context;
+    int value;
+    for(long i = 0; i < count; i++){
+        if(dequeueIntQueue(c->intQueue, &value)){
+            c->sum += value;
+        }
+    }
+}
+
+void intEnqueueBatchBody(void * context, long first, long count){
+    QueueContext * c = context;
+    for(long i = first; i < first + count; i += BATCH){
+        int batch = first + count - i < BATCH ? first + count - i : BATCH;
+        enqueueBatchIntQueue(c->intQueue, &c->values[i], batch);
+    }
+}
+
+void intDequeueBatchBody(void * context, long first, long count){
+    QueueContext * c = context;
+    int values[BATCH];
+    for(long i = 0; i < count; i += BATCH){
+        if(dequeueBatchIntQueue(c->intQueue, values, count - i < BATCH ? count - i : BATCH) > 0){
+            c->sum += values[0];
+        }
+    }
+}
+
+void enqueueIntrusiveBody(void * context, long first, long count){
+    QueueContext * c = context;
+    for(long i = first; i < first + count; i++){
+        enqueueIntrusive(c->intrusive, &c->items[i]);
+    }
+}
+
+void dequeueIntrusiveBody(void * context, long first, long count){
+    QueueContext * c = context;
+    for(long i = 0; i < count; i++){
+        dequeueIntrusive(c->intrusive);
+    }
+}
+
+/*
+ * Function: moveIntrusiveBody
+ * ----------------------------
+ * one op moves the front item of one queue to the back of the other.
+ */
+void moveIntrusiveBody(void * context, long first, long count){
+    QueueContext * c = context;
+    for(long i = 0; i < count; i++){
+        enqueueIntrusive(c->other, dequeueIntrusive(c->intrusive));
+    }
+    IntrusiveQueue * swap = c->intrusive;
+    c->intrusive = c->other;
+    c->other = swap;
+}
+
+void enqueueMPMCBody(void * context, long first, long count){
+    QueueContext * c = context;
+    for(long i = first; i < first + count; i++){
+        tryEnqueueMPMC(c->mpmc, &c->values[i]);
+    }
+}
+
+void dequeueMPMCBody(void * context, long first, long count){
+    QueueContext * c = context;
+    void * data;
+    for(long i = 0; i < count; i++){
+        tryDequeueMPMC(c->mpmc, &data);
+    }
+}
+
+/*
+ * Function: enqueueDequeueBlockingBody
+ * ----------------------------
+ * one op is an enqueue followed by a dequeue, so the cost of the lock is
+ *      measured without any waiting.
+ */
+void enqueueDequeueBlockingBody(void * context, long first, long count){
+    QueueContext * c = context;
+    void * data;
+    for(long i = first; i < first + count; i++){
+        enqueueBlocking(c->blocking, &c->values[i]);
+        dequeueBlocking(c->blocking, &data);
+    }
+}
+
+int main(int argc, char ** argv){
+    Bench bench;
+    QueueContext context;
+    if(!benchInit(&bench, argc, argv)){
+        return 1;
+    }
+    context.values = malloc(sizeof(int) * bench.maxSize);
+    context.pointers = malloc(sizeof(int *) * bench.maxSize);
+    context.items = malloc(sizeof(QueueItem) * bench.maxSize);
+    context.sum = 0;
+    if(context.values == NULL || context.pointers == NULL || context.items == NULL){
+        return 1;
+    }
+    for(long i = 0; i < bench.maxSize; i++){
+        context.values[i] = (int)i;
+        context.pointers[i] = &context.values[i];
+        context.items[i].value = (int)i;
+    }
+
+    for(long size = bench.minSize; size <= bench.maxSize; size *= 10){
+        context.queue = createQueue(&noDestroyFunc, &noPrintFunc);
+        benchRun(&bench, "queue", "enqueue", size, size, size / 10, NULL, &enqueueBody, &context);
+        benchRun(&bench, "queue", "enqueue_dequeue", size, size, size / 10, NULL, &enqueueDequeueBody, &context);
+        benchRun(&bench, "queue", "dequeue", size, size, size / 10, NULL, &dequeueBody, &context);
+        destroyQueue(context.queue);
+
+        context.queue = createQueue(&noDestroyFunc, &noPrintFunc);
+        benchRun(&bench, "queue", "enqueueBatch", size, size, size / (BATCH * 4), NULL, &enqueueBatchBody, &context);
+        benchRun(&bench, "queue", "dequeueBatch", size, size, size / (BATCH * 4), NULL, &dequeueBatchBody, &context);
+        destroyQueue(context.queue);
+
+        context.intQueue = createIntQueue();
+        benchRun(&bench, "intQueue", "enqueue", size, size, size / 10, NULL, &intEnqueueBody, &context);
+        benchRun(&bench, "intQueue", "dequeue", size, size, size / 10, NULL, &intDequeueBody, &context);
+        benchRun(&bench, "intQueue", "enqueueBatch", size, size, size / (BATCH * 4), NULL, &intEnqueueBatchBody, &context);
+        benchRun(&bench, "intQueue", "dequeueBatch", size, size, size / (BATCH * 4), NULL, &intDequeueBatchBody, &context);
+        destroyIntQueue(context.intQueue);
+
+        context.intrusive = createIntrusiveQueue(offsetof(QueueItem, link), NULL, &noPrintFunc);
+        context.other = createIntrusiveQueue(offsetof(QueueItem, link), NULL, &noPrintFunc);
+        benchRun(&bench, "intrusiveQueue", "enqueueIntrusive", size, size, size / 10, NULL, &enqueueIntrusiveBody, &context);
+        benchRun(&bench, "intrusiveQueue", "move", size, size, size / 10, NULL, &moveIntrusiveBody, &context);
+        benchRun(&bench, "intrusiveQueue", "dequeueIntrusive", size, size, size / 10, NULL, &dequeueIntrusiveBody, &context);
+        destroyIntrusiveQueue(context.intrusive);
+        destroyIntrusiveQueue(context.other);
+
+        context.mpmc = createMPMCQueue(size, &noDestroyFunc, &noPrintFunc);
+        benchRun(&bench, "mpmcQueue", "tryEnqueueMPMC", size, size, size / 10, NULL, &enqueueMPMCBody, &context);
+        benchRun(&bench, "mpmcQueue", "tryDequeueMPMC", size, size, size / 10, NULL, &dequeueMPMCBody, &context);
+        destroyMPMCQueue(context.mpmc);
+
+        context.blocking = createBlockingQueue(size, &noDestroyFunc, &noPrintFunc);
+        benchRun(&bench, "blockingQueue", "enqueue_dequeue", size, size, size / 10, NULL, &enqueueDequeueBlockingBody, &context);
+        destroyBlockingQueue(context.blocking);
+    }
+    benchFinish(&bench);
+    free(context.values);
+    free(context.pointers);
+    free(context.items);
+    return 0;
+}
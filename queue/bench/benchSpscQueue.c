@@ -0,0 +1,214 @@
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+#include "spscQueue.h"
+#include "mpmcQueue.h"
+#include "blockingQueue.h"
+
+/*
+ * Benchmark: benchSpscQueue
+ * ----------------------------
+ * Measures the throughput of passing items from one producer thread to one
+ *      consumer thread through the SPSCQueue, one item at a time and in
+ *      batches of BATCH, against the MPMCQueue and the BlockingQueue.  When
+ *      there are at least two processors the producer is pinned to
+ *      processor 0 and the consumer to processor 1.
+ *
+ * usage: benchSpscQueue [items] [capacity]
+ *      items defaults to 10^7 and capacity to 1024.
+ *
+ * output: CSV with one row per queue type.
+ */
+
+#define BATCH 64
+
+typedef struct benchArgs{
+    SPSCQueue * spsc;
+    MPMCQueue * mpmc;
+    BlockingQueue * blocking;
+    pthread_barrier_t * barrier;
+    long items;
+    int cpu;
+    long received;
+}BenchArgs;
+
+void noDestroyFunc(void * data){
+}
+
+void noPrintFunc(void * data){
+}
+
+double now(void){
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+/*
+ * Function: start
+ * ----------------------------
+ * pins the calling thread to its processor, if it has one, and waits for
+ *      the other thread.
+ */
+void start(BenchArgs * args){
+    if(args->cpu >= 0){
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(args->cpu, &cpus);
+        pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpus);
+    }
+    pthread_barrier_wait(args->barrier);
+}
+
+void * spscProducer(void * arg){
+    BenchArgs * args = arg;
+    start(args);
+    for(long i = 1; i <= args->items; i++){
+        enqueueSPSC(args->spsc, (void *)i);
+    }
+    return NULL;
+}
+
+void * spscConsumer(void * arg){
+    BenchArgs * args = arg;
+    start(args);
+    for(long i = 0; i < args->items; i++){
+        args->received += (long)dequeueSPSC(args->spsc);
+    }
+    return NULL;
+}
+
+void * spscBatchProducer(void * arg){
+    BenchArgs * args = arg;
+    void * items[BATCH];
+    start(args);
+    for(long i = 1; i <= args->items;){
+        int count = args->items - i + 1 < BATCH ? args->items - i + 1 : BATCH;
+        for(int j = 0; j < count; j++){
+            items[j] = (void *)(i + j);
+        }
+        for(int sent = 0, spins = 0; sent < count; spins++){
+            sent += enqueueBatchSPSC(args->spsc, items + sent, count - sent);
+            if(spins > 64){
+                sched_yield();
+            }
+        }
+        i += count;
+    }
+    return NULL;
+}
+
+void * spscBatchConsumer(void * arg){
+    BenchArgs * args = arg;
+    void * items[BATCH];
+    start(args);
+    for(long i = 0, spins = 0; i < args->items; spins++){
+        int count = dequeueBatchSPSC(args->spsc, items, BATCH);
+        for(int j = 0; j < count; j++){
+            args->received += (long)items[j];
+        }
+        i += count;
+        if(count == 0 && spins > 64){
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+void * mpmcProducer(void * arg){
+    BenchArgs * args = arg;
+    start(args);
+    for(long i = 1; i <= args->items; i++){
+        enqueueMPMC(args->mpmc, (void *)i);
+    }
+    return NULL;
+}
+
+void * mpmcConsumer(void * arg){
+    BenchArgs * args = arg;
+    start(args);
+    for(long i = 0; i < args->items; i++){
+        args->received += (long)dequeueMPMC(args->mpmc);
+    }
+    return NULL;
+}
+
+void * blockingProducer(void * arg){
+    BenchArgs * args = arg;
+    start(args);
+    for(long i = 1; i <= args->items; i++){
+        enqueueBlocking(args->blocking, (void *)i);
+    }
+    return NULL;
+}
+
+void * blockingConsumer(void * arg){
+    BenchArgs * args = arg;
+    void * data;
+    start(args);
+    for(long i = 0; i < args->items; i++){
+        dequeueBlocking(args->blocking, &data);
+        args->received += (long)data;
+    }
+    return NULL;
+}
+
+/*
+ * Function: run
+ * ----------------------------
+ * runs a producer and a consumer thread against the queues in args,
+ *      prints the throughput and checks every item arrived.
+ */
+void run(char * name, int capacity, void * (*producer)(void *), void * (*consumer)(void *), BenchArgs * args, int pinned){
+    pthread_t threads[2];
+    pthread_barrier_t barrier;
+    BenchArgs producerArgs = *args;
+    BenchArgs consumerArgs = *args;
+    pthread_barrier_init(&barrier, NULL, 3);
+    producerArgs.barrier = &barrier;
+    producerArgs.cpu = pinned ? 0 : -1;
+    consumerArgs.barrier = &barrier;
+    consumerArgs.cpu = pinned ? 1 : -1;
+    consumerArgs.received = 0;
+    pthread_create(&threads[0], NULL, consumer, &consumerArgs);
+    pthread_create(&threads[1], NULL, producer, &producerArgs);
+    pthread_barrier_wait(&barrier);
+    double seconds = now();
+    pthread_join(threads[0], NULL);
+    pthread_join(threads[1], NULL);
+    seconds = now() - seconds;
+    pthread_barrier_destroy(&barrier);
+    if(consumerArgs.received != args->items * (args->items + 1) / 2){
+        fprintf(stderr, "%s: items lost or duplicated\n", name);
+    }
+    printf("%s,%ld,%d,%d,%.6f,%.0f\n", name, args->items, capacity, pinned, seconds, args->items / seconds);
+}
+
+int main(int argc, char ** argv){
+    BenchArgs args;
+    args.items = argc > 1 ? atol(argv[1]) : 10000000;
+    int capacity = argc > 2 ? atoi(argv[2]) : 1024;
+    int pinned = sysconf(_SC_NPROCESSORS_ONLN) >= 2;
+    if(args.items < 1 || capacity < 1){
+        fprintf(stderr, "usage: %s [items] [capacity]\n", argv[0]);
+        return 1;
+    }
+
+    printf("queue,items,capacity,pinned,seconds,ops_per_sec\n");
+    args.spsc = createSPSCQueue(capacity, &noDestroyFunc, &noPrintFunc);
+    run("spsc", capacity, &spscProducer, &spscConsumer, &args, pinned);
+    run("spscBatch", capacity, &spscBatchProducer, &spscBatchConsumer, &args, pinned);
+    destroySPSCQueue(args.spsc);
+
+    args.mpmc = createMPMCQueue(capacity, &noDestroyFunc, &noPrintFunc);
+    run("mpmc", capacity, &mpmcProducer, &mpmcConsumer, &args, pinned);
+    destroyMPMCQueue(args.mpmc);
+
+    args.blocking = createBlockingQueue(capacity, &noDestroyFunc, &noPrintFunc);
+    run("blocking", capacity, &blockingProducer, &blockingConsumer, &args, pinned);
+    destroyBlockingQueue(args.blocking);
+    return 0;
+}
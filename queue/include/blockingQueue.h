@@ -0,0 +1,171 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <pthread.h>
+#include "queue.h"
+#ifndef BLOCKING_QUEUE_H
+#define BLOCKING_QUEUE_H
+
+/*
+ * Struct: BlockingQueue
+ * ----------------------------
+ * Represents a bounded FIFO queue that may be used by any number of
+ *      producer and consumer threads at once.  Producers wait while the
+ *      queue is full and consumers wait while it is empty, so a slow
+ *      consumer holds back its producers instead of letting the queue grow
+ *      without limit.
+ *
+ * queue: The Queue holding the data, only used with lock held.
+ * capacity: The maximum number of items in the queue.
+ * closed: 1 once closeBlockingQueue has been called.
+ * lock: The mutex guarding the queue.
+ * notEmpty: Signalled when an item is added, for waiting consumers.
+ * notFull: Signalled when an item is removed, for waiting producers.
+ *
+ */
+typedef struct blockingQueue{
+    Queue * queue;
+    int capacity;
+    int closed;
+    pthread_mutex_t lock;
+    pthread_cond_t notEmpty;
+    pthread_cond_t notFull;
+}BlockingQueue;
+
+/*
+ * Function: createBlockingQueue
+ * ----------------------------
+ * Creates a pointer to a blocking bounded queue
+ *
+ * capacity: the maximum number of items the queue holds.  At least one.
+ * destroyFunc: a function pointer that destroys the data type intended
+ *      to be stored in the queue
+ * printFunc: a function pointer that prints the data type intended to
+ *      be stored in the queue
+ *
+ * return: a pointer to the created queue.  NULL if failed.
+ */
+BlockingQueue * createBlockingQueue(int capacity, void (*destroyFunc)(void * data), void(*printFunc)(void * data));
+
+/*
+ * Function: enqueueBlocking
+ * ----------------------------
+ * Adds new data to the end of the queue, waiting for room if the queue
+ *      is full.  Safe to call from any number of threads.
+ *
+ * queue: the queue to perform the enqueue operation on.
+ * data: the data to added to the end of the queue.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure, the queue is closed or NULL
+ * 1: success
+ */
+int enqueueBlocking(BlockingQueue * queue, void * data);
+
+/*
+ * Function: dequeueBlocking
+ * ----------------------------
+ * removes the next value in the queue, waiting for one if the queue is
+ *      empty.  Safe to call from any number of threads.
+ *
+ * queue: the queue to perform the dequeue operation on.
+ * data: set to the removed data on success.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure, the queue is closed and empty, or NULL
+ * 1: success
+ */
+int dequeueBlocking(BlockingQueue * queue, void ** data);
+
+/*
+ * Function: timedEnqueueBlocking
+ * ----------------------------
+ * Adds new data to the end of the queue, waiting at most timeout
+ *      milliseconds for room if the queue is full.
+ *
+ * queue: the queue to perform the enqueue operation on.
+ * data: the data to added to the end of the queue.
+ * timeout: the longest time to wait in milliseconds.  0 does not wait and
+ *      a negative timeout waits as long as enqueueBlocking.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * -1: the queue was still full when the timeout ran out
+ * 0: failure, the queue is closed or NULL
+ * 1: success
+ */
+int timedEnqueueBlocking(BlockingQueue * queue, void * data, long timeout);
+
+/*
+ * Function: timedDequeueBlocking
+ * ----------------------------
+ * removes the next value in the queue, waiting at most timeout
+ *      milliseconds for one if the queue is empty.
+ *
+ * queue: the queue to perform the dequeue operation on.
+ * data: set to the removed data on success.
+ * timeout: the longest time to wait in milliseconds.  0 does not wait and
+ *      a negative timeout waits as long as dequeueBlocking.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * -1: the queue was still empty when the timeout ran out
+ * 0: failure, the queue is closed and empty, or NULL
+ * 1: success
+ */
+int timedDequeueBlocking(BlockingQueue * queue, void ** data, long timeout);
+
+/*
+ * Function: closeBlockingQueue
+ * ----------------------------
+ * Closes the queue and wakes every waiting thread.  Once closed, enqueues
+ *      fail and dequeues return the items left in the queue, then fail.
+ *
+ * queue: the queue to close.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int closeBlockingQueue(BlockingQueue * queue);
+
+/*
+ * Function: lengthBlocking
+ * ----------------------------
+ * returns the number of items in the queue.  The value is a snapshot and
+ *      may be stale by the time it is used if other threads are active.
+ *
+ * queue: the queue to measure.
+ *
+ * return: the number of items in the queue.  -1 if the queue is NULL.
+ */
+int lengthBlocking(BlockingQueue * queue);
+
+/*
+ * Function: destroyBlockingQueue
+ * ----------------------------
+ * Frees the queue and all data stored in the queue using the destroyData
+ *      function pointer
+ *
+ * queue: the queue to perform the destroy operation on.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ *
+ * note: No other thread may be using or waiting on the queue when it is
+ *      destroyed.  Close the queue and join its threads first.
+ */
+int destroyBlockingQueue(BlockingQueue * queue);
+
+/*
+ * Function: printBlockingQueue
+ * ----------------------------
+ * prints all of the data in the queue as per the printData funtion pointer
+ *
+ * queue: the queue to perform the print operation on.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int printBlockingQueue(BlockingQueue * queue);
+
+#endif
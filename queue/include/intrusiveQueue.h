@@ -0,0 +1,127 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stddef.h>
+#ifndef INTRUSIVE_QUEUE_H
+#define INTRUSIVE_QUEUE_H
+
+/*
+ * Struct: QueueLink
+ * ----------------------------
+ * The link of an item in an intrusive queue.  The caller embeds one in the
+ *      struct of each item, so queueing an item allocates nothing.
+ *
+ * next: the link of the item behind this one.  NULL at the back.
+ */
+typedef struct queueLink{
+    struct queueLink * next;
+}QueueLink;
+
+/*
+ * Struct: IntrusiveQueue
+ * ----------------------------
+ * Represents a FIFO queue of items that carry their own links.  The items
+ *      are passed in and returned as pointers to the items themselves, like
+ *      the data of a Queue.
+ *
+ * head: the link of the next item to be removed.
+ * tail: the link of the item most recently added.
+ * offset: the offset of the QueueLink within each item, from offsetof.
+ * destroyData: A function pointer that is used to free the items still in
+ *      the queue when it is destroyed.  NULL to leave them to the caller.
+ * printData: A function pointer used to print the items in the queue.
+ * length: The number of items in the queue.
+ *
+ */
+typedef struct intrusiveQueue{
+    QueueLink * head;
+    QueueLink * tail;
+    size_t offset;
+    void (*destroyData)(void * data);
+    void (*printData)(void * data);
+    int length;
+}IntrusiveQueue;
+
+/*
+ * Function: createIntrusiveQueue
+ * ----------------------------
+ * Creates a pointer to an intrusive queue data structure
+ *
+ * offset: the offset of the QueueLink within the items, e.g.
+ *      offsetof(Job, link).  An item may be in several queues at once
+ *      through different links.
+ * destroyFunc: a function pointer that destroys the items left in the
+ *      queue when it is destroyed.  May be NULL.
+ * printFunc: a function pointer that prints an item.
+ *
+ * return: a pointer to the created queue.  NULL if failed.
+ */
+IntrusiveQueue * createIntrusiveQueue(size_t offset, void (*destroyFunc)(void * data), void (*printFunc)(void * data));
+
+/*
+ * Function: enqueueIntrusive
+ * ----------------------------
+ * Adds an item to the end of the queue
+ *
+ * queue: the queue to perform the enqueue operation on.
+ * data: the item to add.  Its link must not be in use by another queue.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int enqueueIntrusive(IntrusiveQueue * queue, void * data);
+
+/*
+ * Function: dequeueIntrusive
+ * ----------------------------
+ * removes the next item in the queue and returns it.  Its link may be
+ *      used to add it to another queue straight away.
+ *
+ * queue: the queue to perform the dequeue operation on.
+ *
+ * return: the item at the front of the queue.  NULL if empty.
+ */
+void * dequeueIntrusive(IntrusiveQueue * queue);
+
+/*
+ * Function: concatIntrusiveQueue
+ * ----------------------------
+ * Moves every item of src to the end of dest in O(1), leaving src empty.
+ *
+ * dest: the queue to add the items to.
+ * src: the queue to take the items from.  Must use the same link offset.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int concatIntrusiveQueue(IntrusiveQueue * dest, IntrusiveQueue * src);
+
+/*
+ * Function: destroyIntrusiveQueue
+ * ----------------------------
+ * Frees the queue, and the items left in it if it has a destroyData.
+ *
+ * queue: the queue to perform the destroy operation on.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int destroyIntrusiveQueue(IntrusiveQueue * queue);
+
+/*
+ * Function: printIntrusiveQueue
+ * ----------------------------
+ * prints all of the items in the queue as per the printData funtion pointer
+ *
+ * queue: the queue to perform the print operation on.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ *
+ */
+int printIntrusiveQueue(IntrusiveQueue * queue);
+
+#endif
@@ -0,0 +1,169 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stddef.h>
+#include <stdatomic.h>
+#ifndef MPMC_QUEUE_H
+#define MPMC_QUEUE_H
+
+#define MPMC_CACHE_LINE 64
+
+/*
+ * Struct: MPMCSlot
+ * ----------------------------
+ * A slot in the ring buffer of a MPMCQueue.
+ *
+ * sequence: the position the slot is waiting for.  A producer may write the
+ *      slot when sequence equals its enqueue position, and a consumer may
+ *      read it when sequence equals its dequeue position plus one.
+ * data: the data stored in the slot
+ *
+ */
+typedef struct mpmcSlot{
+    atomic_size_t sequence;
+    void * data;
+}MPMCSlot;
+
+/*
+ * Struct: MPMCQueue
+ * ----------------------------
+ * Represents a bounded lock free FIFO queue that may be used by any number of
+ *      producer and consumer threads at once.
+ *
+ * buffer: The ring buffer of slots.
+ * mask: The number of slots minus one.  The number of slots is a power of two.
+ * destroyData: A function pointer that is used to free the data
+ *      stored in the queue.
+ * printData: A function pointer used to print the data in the queue.
+ * enqueuePos: The position the next producer will claim.
+ * dequeuePos: The position the next consumer will claim.
+ *
+ * note: enqueuePos and dequeuePos are kept on separate cache lines so
+ *      producers and consumers do not invalidate each other's line.
+ */
+typedef struct mpmcQueue{
+    MPMCSlot * buffer;
+    size_t mask;
+    void (*destroyData)(void * data);
+    void (*printData)(void * data);
+    _Alignas(MPMC_CACHE_LINE) atomic_size_t enqueuePos;
+    _Alignas(MPMC_CACHE_LINE) atomic_size_t dequeuePos;
+}MPMCQueue;
+
+/*
+ * Function: createMPMCQueue
+ * ----------------------------
+ * Creates a pointer to a multi producer multi consumer queue
+ *
+ * capacity: the maximum number of items the queue holds.  Rounded up to a
+ *      power of two.
+ * destroyFunc: a function pointer that destroys the data type intended
+ *      to be stored in the queue
+ * printFunc: a function pointer that prints the data type intended to
+ *      be stored in the queue
+ *
+ * return: a pointer to the created queue.  NULL if failed.
+ */
+MPMCQueue * createMPMCQueue(int capacity, void (*destroyFunc)(void * data), void(*printFunc)(void * data));
+
+/*
+ * Function: tryEnqueueMPMC
+ * ----------------------------
+ * Adds new data to the end of the queue if there is room.  Safe to call
+ *      from any number of threads.
+ *
+ * queue: the queue to perform the enqueue operation on.
+ * data: the data to added to the end of the queue.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure, the queue is full
+ * 1: success
+ */
+int tryEnqueueMPMC(MPMCQueue * queue, void * data);
+
+/*
+ * Function: tryDequeueMPMC
+ * ----------------------------
+ * removes the next value in the queue if there is one.  Safe to call
+ *      from any number of threads.
+ *
+ * queue: the queue to perform the dequeue operation on.
+ * data: set to the removed data on success.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure, the queue is empty
+ * 1: success
+ */
+int tryDequeueMPMC(MPMCQueue * queue, void ** data);
+
+/*
+ * Function: enqueueMPMC
+ * ----------------------------
+ * Adds new data to the end of the queue, waiting for room if the queue
+ *      is full.
+ *
+ * queue: the queue to perform the enqueue operation on.
+ * data: the data to added to the end of the queue.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int enqueueMPMC(MPMCQueue * queue, void * data);
+
+/*
+ * Function: dequeueMPMC
+ * ----------------------------
+ * removes the next value in the queue, waiting for one if the queue
+ *      is empty.
+ *
+ * queue: the queue to perform the dequeue operation on.
+ *
+ * return: a void pointer of the data stored in the next position in
+ *     queue.  NULL if the queue is NULL.
+ */
+void * dequeueMPMC(MPMCQueue * queue);
+
+/*
+ * Function: lengthMPMC
+ * ----------------------------
+ * returns the number of items in the queue.  The value is a snapshot and
+ *      may be stale by the time it is used if other threads are active.
+ *
+ * queue: the queue to measure.
+ *
+ * return: the number of items in the queue.  -1 if the queue is NULL.
+ */
+int lengthMPMC(MPMCQueue * queue);
+
+/*
+ * Function: destroyMPMCQueue
+ * ----------------------------
+ * Frees the queue and all data stored in the queue using the destroyData
+ *      function pointer
+ *
+ * queue: the queue to perform the destroy operation on.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ *
+ * note: No other thread may be using the queue when it is destroyed.
+ */
+int destroyMPMCQueue(MPMCQueue * queue);
+
+/*
+ * Function: printMPMCQueue
+ * ----------------------------
+ * prints all of the data in the queue as per the printData funtion pointer
+ *
+ * queue: the queue to perform the print operation on.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ *
+ * note: No other thread may be using the queue while it is printed.
+ */
+int printMPMCQueue(MPMCQueue * queue);
+
+#endif
@@ -2,36 +2,27 @@
 #include <stdio.h>
 #ifndef QUEUE_H
 #define QUEUE_H
-/*
- * Struct: Node
- * ----------------------------
- * A data structure that holds the data of queue.  A new Node is
- *      created for each value added to the queue
- *      
- * next: the next node in the queue
- * data: the data stored in the Node
- * 
- */
-typedef struct queueNode{
-    struct queueNode * next;
-    void * data;
-}QueueNode;
+#define QUEUE_INITIAL_CAPACITY 16
 
 /*
  * Struct: Queue
  * ----------------------------
- * Represents the Queue data structure.
+ * Represents the Queue data structure.  The data is stored in a ring
+ *      buffer whose capacity is always a power of two.
  *      
- * head: The first Node in the queue and the next to be removed.
- * tail: The last Node in the queue and the last to be removed.
+ * buffer: The ring buffer holding the data in the queue.
+ * capacity: The number of slots in the buffer.
+ * head: The index of the slot holding the next item to be removed.
  * destroyData: A function pointer that is used to free the data
  *      stored in the Queue.
  * printData: A function pointer used to print the data in the Queue.
+ * length: The number of items in the queue.
  * 
  */
 typedef struct queue{
-    QueueNode * head;
-    QueueNode * tail;
+    void ** buffer;
+    int capacity;
+    int head;
     void (*destroyData)(void * data);
     void (*printData)(void * data);
     int length;
@@ -39,6 +30,23 @@ typedef struct queue{
 }Queue;
 
 
+/*
+ * Struct: QueueIterator
+ * ----------------------------
+ * A position in a queue used to walk the queue from front to back or back
+ *      to front without removing items.
+ * 
+ * queue: the queue being iterated over.
+ * position: the distance of the item from the front of the queue.
+ * 
+ * note: enqueue keeps iterators valid.  dequeue shifts every position
+ *      forward by one item.
+ */
+typedef struct queueIterator{
+    Queue * queue;
+    int position;
+}QueueIterator;
+
 /*
  * Function: createQueue
  * ----------------------------
@@ -49,7 +57,7 @@ typedef struct queue{
  * printFunc: a function pointer that prints the data type intended to
  *      be stored in the queue
  * 
- * return: a pointer to the created queue
+ * return: a pointer to the created queue.  NULL if failed.
  */
 Queue * createQueue(void (*destroyFunc)(void * data), void(*printFunc)(void * data));
 
@@ -79,6 +87,36 @@ void * dequeue(Queue * queue);
  */
 int enqueue(Queue * queue, void * data);
 
+/*
+ * Function: enqueueBatch
+ * ----------------------------
+ * Adds count items to the end of the queue in order.  The ring buffer is
+ *      grown once for the whole batch and the items are copied in at most
+ *      two blocks.
+ * 
+ * queue: the queue to perform the enqueue operation on.
+ * items: the data to be added, first item first.
+ * count: the number of items.
+ * 
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure, no items were added
+ * 1: success
+ */
+int enqueueBatch(Queue * queue, void ** items, int count);
+
+/*
+ * Function: dequeueBatch
+ * ----------------------------
+ * removes up to count items from the front of the queue into an array.
+ * 
+ * queue: the queue to perform the dequeue operation on.
+ * items: filled with the removed data, front of the queue first.
+ * count: the size of items.
+ * 
+ * return: the number of items removed.  0 if the queue is NULL or empty.
+ */
+int dequeueBatch(Queue * queue, void ** items, int count);
+
 /*
  * Function: destroyQueue
  * ----------------------------
@@ -111,4 +149,74 @@ int destroyQueue(Queue * queue);
  */
 int printQueue(Queue * queue);
 
+/*
+ * Function: iterBeginQueue
+ * ----------------------------
+ * Creates an iterator positioned at the front of the queue, the next item
+ *      to be dequeued.
+ * 
+ * queue: the queue to iterate over.
+ * 
+ * return: an iterator on the front item.  The iterator is not valid if the
+ *      queue is empty or NULL.
+ */
+QueueIterator iterBeginQueue(Queue * queue);
+
+/*
+ * Function: iterEndQueue
+ * ----------------------------
+ * Creates an iterator positioned at the back of the queue, the item most
+ *      recently enqueued, for walking the queue backwards.
+ * 
+ * queue: the queue to iterate over.
+ * 
+ * return: an iterator on the back item.  The iterator is not valid if the
+ *      queue is empty or NULL.
+ */
+QueueIterator iterEndQueue(Queue * queue);
+
+/*
+ * Function: iterValidQueue
+ * ----------------------------
+ * Checks whether the iterator is positioned on an item.
+ * 
+ * iterator: the iterator to check.
+ * 
+ * return: 1 if the iterator is on an item. 0 if it has run off either end.
+ */
+int iterValidQueue(QueueIterator * iterator);
+
+/*
+ * Function: iterGetQueue
+ * ----------------------------
+ * retrieve the item the iterator is positioned on.
+ * 
+ * iterator: the iterator to read.
+ * 
+ * return: a pointer of the data at the iterator.  NULL if not valid.
+ */
+void * iterGetQueue(QueueIterator * iterator);
+
+/*
+ * Function: iterNextQueue
+ * ----------------------------
+ * moves the iterator one item towards the back of the queue.
+ * 
+ * iterator: the iterator to move.
+ * 
+ * return: 1 if the iterator is on an item after moving. 0 otherwise.
+ */
+int iterNextQueue(QueueIterator * iterator);
+
+/*
+ * Function: iterPrevQueue
+ * ----------------------------
+ * moves the iterator one item towards the front of the queue.
+ * 
+ * iterator: the iterator to move.
+ * 
+ * return: 1 if the iterator is on an item after moving. 0 otherwise.
+ */
+int iterPrevQueue(QueueIterator * iterator);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,191 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stddef.h>
+#include <stdatomic.h>
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+#define SPSC_CACHE_LINE 64
+
+/*
+ * Struct: SPSCQueue
+ * ----------------------------
+ * Represents a bounded wait free FIFO queue for exactly one producer thread
+ *      and one consumer thread.  Each side owns one position and only
+ *      reads the other's, so no compare and swap is needed.
+ *
+ * buffer: The ring buffer of data.
+ * mask: The number of slots minus one.  The number of slots is a power of two.
+ * destroyData: A function pointer that is used to free the data
+ *      stored in the queue.
+ * printData: A function pointer used to print the data in the queue.
+ * tail: The position the producer writes next.  Written only by the producer.
+ * cachedHead: The producer's last copy of head.  head is only read again
+ *      when the queue looks full from this copy.
+ * head: The position the consumer reads next.  Written only by the consumer.
+ * cachedTail: The consumer's last copy of tail.  tail is only read again
+ *      when the queue looks empty from this copy.
+ *
+ * note: the producer's and consumer's fields are kept on separate cache
+ *      lines, and the cached copies mean a side only touches the other's
+ *      line once per batch of items rather than once per item.
+ */
+typedef struct spscQueue{
+    void ** buffer;
+    size_t mask;
+    void (*destroyData)(void * data);
+    void (*printData)(void * data);
+    _Alignas(SPSC_CACHE_LINE) atomic_size_t tail;
+    size_t cachedHead;
+    _Alignas(SPSC_CACHE_LINE) atomic_size_t head;
+    size_t cachedTail;
+}SPSCQueue;
+
+/*
+ * Function: createSPSCQueue
+ * ----------------------------
+ * Creates a pointer to a single producer single consumer queue
+ *
+ * capacity: the maximum number of items the queue holds.  Rounded up to a
+ *      power of two.
+ * destroyFunc: a function pointer that destroys the data type intended
+ *      to be stored in the queue
+ * printFunc: a function pointer that prints the data type intended to
+ *      be stored in the queue
+ *
+ * return: a pointer to the created queue.  NULL if failed.
+ */
+SPSCQueue * createSPSCQueue(int capacity, void (*destroyFunc)(void * data), void(*printFunc)(void * data));
+
+/*
+ * Function: tryEnqueueSPSC
+ * ----------------------------
+ * Adds new data to the end of the queue if there is room.  Only the
+ *      producer thread may call it.
+ *
+ * queue: the queue to perform the enqueue operation on.
+ * data: the data to added to the end of the queue.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure, the queue is full
+ * 1: success
+ */
+int tryEnqueueSPSC(SPSCQueue * queue, void * data);
+
+/*
+ * Function: tryDequeueSPSC
+ * ----------------------------
+ * removes the next value in the queue if there is one.  Only the consumer
+ *      thread may call it.
+ *
+ * queue: the queue to perform the dequeue operation on.
+ * data: set to the removed data on success.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure, the queue is empty
+ * 1: success
+ */
+int tryDequeueSPSC(SPSCQueue * queue, void ** data);
+
+/*
+ * Function: enqueueBatchSPSC
+ * ----------------------------
+ * Adds as many of count items to the end of the queue as there is room
+ *      for, and publishes them to the consumer at once.  Only the producer
+ *      thread may call it.
+ *
+ * queue: the queue to perform the enqueue operation on.
+ * items: the data to be added, first item first.
+ * count: the number of items.
+ *
+ * return: the number of items added, from the front of items.  0 if the
+ *      queue is full or NULL.
+ */
+int enqueueBatchSPSC(SPSCQueue * queue, void ** items, int count);
+
+/*
+ * Function: dequeueBatchSPSC
+ * ----------------------------
+ * removes up to count items from the front of the queue into an array,
+ *      and hands their slots back to the producer at once.  Only the
+ *      consumer thread may call it.
+ *
+ * queue: the queue to perform the dequeue operation on.
+ * items: filled with the removed data, front of the queue first.
+ * count: the size of items.
+ *
+ * return: the number of items removed.  0 if the queue is empty or NULL.
+ */
+int dequeueBatchSPSC(SPSCQueue * queue, void ** items, int count);
+
+/*
+ * Function: enqueueSPSC
+ * ----------------------------
+ * Adds new data to the end of the queue, waiting for room if the queue
+ *      is full.  Only the producer thread may call it.
+ *
+ * queue: the queue to perform the enqueue operation on.
+ * data: the data to added to the end of the queue.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int enqueueSPSC(SPSCQueue * queue, void * data);
+
+/*
+ * Function: dequeueSPSC
+ * ----------------------------
+ * removes the next value in the queue, waiting for one if the queue
+ *      is empty.  Only the consumer thread may call it.
+ *
+ * queue: the queue to perform the dequeue operation on.
+ *
+ * return: a void pointer of the data stored in the next position in
+ *     queue.  NULL if the queue is NULL.
+ */
+void * dequeueSPSC(SPSCQueue * queue);
+
+/*
+ * Function: lengthSPSC
+ * ----------------------------
+ * returns the number of items in the queue.  The value is a snapshot and
+ *      may be stale by the time it is used if the other thread is active.
+ *
+ * queue: the queue to measure.
+ *
+ * return: the number of items in the queue.  -1 if the queue is NULL.
+ */
+int lengthSPSC(SPSCQueue * queue);
+
+/*
+ * Function: destroySPSCQueue
+ * ----------------------------
+ * Frees the queue and all data stored in the queue using the destroyData
+ *      function pointer
+ *
+ * queue: the queue to perform the destroy operation on.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ *
+ * note: Neither thread may be using the queue when it is destroyed.
+ */
+int destroySPSCQueue(SPSCQueue * queue);
+
+/*
+ * Function: printSPSCQueue
+ * ----------------------------
+ * prints all of the data in the queue as per the printData funtion pointer
+ *
+ * queue: the queue to perform the print operation on.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ *
+ * note: Neither thread may be using the queue while it is printed.
+ */
+int printSPSCQueue(SPSCQueue * queue);
+
+#endif
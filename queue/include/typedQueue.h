@@ -0,0 +1,160 @@
+#include <stdlib.h>
+#include <string.h>
+#ifndef TYPED_QUEUE_H
+#define TYPED_QUEUE_H
+#define TYPED_QUEUE_INITIAL_CAPACITY 16
+
+/*
+ * Macro: DEFINE_QUEUE
+ * ----------------------------
+ * Defines a FIFO queue that stores values of type T in a power of two ring
+ *      buffer, and the functions to use it.  Values are copied into the
+ *      buffer, so queueing a small scalar such as an id allocates nothing
+ *      once the buffer has grown to the working size of the queue and needs
+ *      no destroy function.
+ *
+ * name: the name of the queue type.  Every function is named after it,
+ *      e.g. DEFINE_QUEUE(IntQueue, int) defines IntQueue, createIntQueue,
+ *      enqueueIntQueue and so on.
+ * T: the type of the values.  Values are copied in and out by assignment.
+ *
+ * The functions mirror those of Queue:
+ *
+ *      name * create##name(void)
+ *      int enqueue##name(name * queue, T value)
+ *      int dequeue##name(name * queue, T * value)
+ *      T * peek##name(name * queue)
+ *      int enqueueBatch##name(name * queue, T * values, int count)
+ *      int dequeueBatch##name(name * queue, T * values, int count)
+ *      int destroy##name(name * queue)
+ *
+ * dequeue copies the front value into value unless it is NULL and returns
+ *      1, or 0 if the queue is empty or NULL.  peek returns a pointer to the
+ *      front value inside the buffer, valid until the queue next changes,
+ *      or NULL if the queue is empty.  The rest return what their Queue
+ *      counterparts do.
+ *
+ * note: the queue does not free anything the values point to.  Every
+ *      function is static inline.
+ */
+#define DEFINE_QUEUE(name, T) \
+typedef struct name{ \
+    T * buffer; \
+    int capacity; \
+    int head; \
+    int length; \
+}name; \
+ \
+static inline name * create##name(void){ \
+    name * queue = malloc(sizeof(name)); \
+    if(queue == NULL){ \
+        return NULL; \
+    } \
+    queue->buffer = malloc(sizeof(T) * TYPED_QUEUE_INITIAL_CAPACITY); \
+    if(queue->buffer == NULL){ \
+        free(queue); \
+        return NULL; \
+    } \
+    queue->capacity = TYPED_QUEUE_INITIAL_CAPACITY; \
+    queue->head = 0; \
+    queue->length = 0; \
+    return queue; \
+} \
+ \
+/* doubles the ring buffer until it holds minCapacity values, moving the
+   values that wrapped around to directly after the old end. */ \
+static inline int grow##name(name * queue, int minCapacity){ \
+    int capacity = queue->capacity; \
+    T * buffer; \
+    if(minCapacity <= capacity){ \
+        return 1; \
+    } \
+    while(capacity < minCapacity){ \
+        capacity *= 2; \
+    } \
+    if((buffer = realloc(queue->buffer, sizeof(T) * capacity)) == NULL){ \
+        return 0; \
+    } \
+    int wrapped = queue->head + queue->length - queue->capacity; \
+    if(wrapped > 0){ \
+        memcpy(buffer + queue->capacity, buffer, sizeof(T) * wrapped); \
+    } \
+    queue->buffer = buffer; \
+    queue->capacity = capacity; \
+    return 1; \
+} \
+ \
+static inline int enqueue##name(name * queue, T value){ \
+    if(queue == NULL){ \
+        return 0; \
+    } \
+    if(queue->length == queue->capacity && !grow##name(queue, queue->length + 1)){ \
+        return 0; \
+    } \
+    queue->buffer[(queue->head + queue->length) & (queue->capacity - 1)] = value; \
+    queue->length++; \
+    return 1; \
+} \
+ \
+static inline int dequeue##name(name * queue, T * value){ \
+    if(queue == NULL || queue->length == 0){ \
+        return 0; \
+    } \
+    if(value != NULL){ \
+        *value = queue->buffer[queue->head]; \
+    } \
+    queue->head = (queue->head + 1) & (queue->capacity - 1); \
+    queue->length--; \
+    return 1; \
+} \
+ \
+static inline T * peek##name(name * queue){ \
+    if(queue == NULL || queue->length == 0){ \
+        return NULL; \
+    } \
+    return &queue->buffer[queue->head]; \
+} \
+ \
+static inline int enqueueBatch##name(name * queue, T * values, int count){ \
+    if(queue == NULL || count < 0 || (values == NULL && count > 0)){ \
+        return 0; \
+    } \
+    if(count == 0){ \
+        return 1; \
+    } \
+    if(!grow##name(queue, queue->length + count)){ \
+        return 0; \
+    } \
+    int tail = (queue->head + queue->length) & (queue->capacity - 1); \
+    int first = queue->capacity - tail < count ? queue->capacity - tail : count; \
+    memcpy(queue->buffer + tail, values, sizeof(T) * first); \
+    memcpy(queue->buffer, values + first, sizeof(T) * (count - first)); \
+    queue->length += count; \
+    return 1; \
+} \
+ \
+static inline int dequeueBatch##name(name * queue, T * values, int count){ \
+    if(queue == NULL || values == NULL || count <= 0){ \
+        return 0; \
+    } \
+    if(count > queue->length){ \
+        count = queue->length; \
+    } \
+    int first = queue->capacity - queue->head < count ? queue->capacity - queue->head : count; \
+    memcpy(values, queue->buffer + queue->head, sizeof(T) * first); \
+    memcpy(values + first, queue->buffer, sizeof(T) * (count - first)); \
+    queue->head = (queue->head + count) & (queue->capacity - 1); \
+    queue->length -= count; \
+    return count; \
+} \
+ \
+static inline int destroy##name(name * queue){ \
+    if(queue == NULL){ \
+        return 0; \
+    } \
+    free(queue->buffer); \
+    free(queue); \
+    return 1; \
+}
+
+#endif
@@ -0,0 +1,296 @@
+#include <errno.h>
+#include <time.h>
+#include "blockingQueue.h"
+
+/**internal functions**/
+
+/*
+ * Function: waitBlocking
+ * ----------------------------
+ * waits on one of the queue's condition variables with the lock held.
+ *
+ * queue: the queue being waited on.
+ * cond: notEmpty or notFull.
+ * timeout: 0 to not wait, negative to wait without a deadline.
+ * deadline: the time on the monotonic clock to stop waiting at when
+ *      timeout is positive.
+ *
+ * return: 1 if woken, which may be spurious.  0 if the time ran out.
+ */
+int waitBlocking(BlockingQueue * queue, pthread_cond_t * cond, long timeout, struct timespec * deadline){
+    if(timeout == 0){
+        return 0;
+    }
+    if(timeout < 0){
+        pthread_cond_wait(cond, &queue->lock);
+        return 1;
+    }
+    return pthread_cond_timedwait(cond, &queue->lock, deadline) != ETIMEDOUT;
+}
+
+/*
+ * Function: deadlineBlocking
+ * ----------------------------
+ * sets deadline to timeout milliseconds from now on the monotonic clock,
+ *      the clock the condition variables are created with.
+ */
+void deadlineBlocking(long timeout, struct timespec * deadline){
+    clock_gettime(CLOCK_MONOTONIC, deadline);
+    deadline->tv_sec += timeout / 1000;
+    deadline->tv_nsec += (timeout % 1000) * 1000000;
+    if(deadline->tv_nsec >= 1000000000){
+        deadline->tv_sec++;
+        deadline->tv_nsec -= 1000000000;
+    }
+}
+
+/**end internal functions**/
+
+/*
+ * Function: createBlockingQueue
+ * ----------------------------
+ * Creates a pointer to a blocking bounded queue
+ *
+ * capacity: the maximum number of items the queue holds.  At least one.
+ * destroyFunc: a function pointer that destroys the data type intended
+ *      to be stored in the queue
+ * printFunc: a function pointer that prints the data type intended to
+ *      be stored in the queue
+ *
+ * return: a pointer to the created queue.  NULL if failed.
+ *
+ * implementation details: the condition variables wait on the monotonic
+ *      clock so a timed wait is not stretched or cut short by changes to
+ *      the wall clock.
+ */
+BlockingQueue * createBlockingQueue(int capacity, void (*destroyFunc)(void * data), void(*printFunc)(void * data)){
+    if(capacity < 1){
+        return NULL;
+    }
+    BlockingQueue * queue = malloc(sizeof(BlockingQueue));
+    if(queue == NULL){
+        return NULL;
+    }
+    queue->queue = createQueue(destroyFunc, printFunc);
+    if(queue->queue == NULL){
+        free(queue);
+        return NULL;
+    }
+    queue->capacity = capacity;
+    queue->closed = 0;
+    pthread_condattr_t attributes;
+    pthread_condattr_init(&attributes);
+    pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);
+    pthread_mutex_init(&queue->lock, NULL);
+    pthread_cond_init(&queue->notEmpty, &attributes);
+    pthread_cond_init(&queue->notFull, &attributes);
+    pthread_condattr_destroy(&attributes);
+    return queue;
+}
+
+/*
+ * Function: enqueueBlocking
+ * ----------------------------
+ * Adds new data to the end of the queue, waiting for room if the queue
+ *      is full.  Safe to call from any number of threads.
+ *
+ * queue: the queue to perform the enqueue operation on.
+ * data: the data to added to the end of the queue.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure, the queue is closed or NULL
+ * 1: success
+ */
+int enqueueBlocking(BlockingQueue * queue, void * data){
+    return timedEnqueueBlocking(queue, data, -1);
+}
+
+/*
+ * Function: dequeueBlocking
+ * ----------------------------
+ * removes the next value in the queue, waiting for one if the queue is
+ *      empty.  Safe to call from any number of threads.
+ *
+ * queue: the queue to perform the dequeue operation on.
+ * data: set to the removed data on success.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure, the queue is closed and empty, or NULL
+ * 1: success
+ */
+int dequeueBlocking(BlockingQueue * queue, void ** data){
+    return timedDequeueBlocking(queue, data, -1);
+}
+
+/*
+ * Function: timedEnqueueBlocking
+ * ----------------------------
+ * Adds new data to the end of the queue, waiting at most timeout
+ *      milliseconds for room if the queue is full.
+ *
+ * queue: the queue to perform the enqueue operation on.
+ * data: the data to added to the end of the queue.
+ * timeout: the longest time to wait in milliseconds.  0 does not wait and
+ *      a negative timeout waits as long as enqueueBlocking.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * -1: the queue was still full when the timeout ran out
+ * 0: failure, the queue is closed or NULL
+ * 1: success
+ */
+int timedEnqueueBlocking(BlockingQueue * queue, void * data, long timeout){
+    if(queue == NULL){
+        return 0;
+    }
+    struct timespec deadline;
+    int result;
+    if(timeout > 0){
+        deadlineBlocking(timeout, &deadline);
+    }
+    pthread_mutex_lock(&queue->lock);
+    while(!queue->closed && queue->queue->length >= queue->capacity &&
+          waitBlocking(queue, &queue->notFull, timeout, &deadline));
+    if(queue->closed){
+        result = 0;
+    }
+    else if(queue->queue->length >= queue->capacity){
+        result = -1;
+    }
+    else if((result = enqueue(queue->queue, data))){
+        pthread_cond_signal(&queue->notEmpty);
+    }
+    pthread_mutex_unlock(&queue->lock);
+    return result;
+}
+
+/*
+ * Function: timedDequeueBlocking
+ * ----------------------------
+ * removes the next value in the queue, waiting at most timeout
+ *      milliseconds for one if the queue is empty.
+ *
+ * queue: the queue to perform the dequeue operation on.
+ * data: set to the removed data on success.
+ * timeout: the longest time to wait in milliseconds.  0 does not wait and
+ *      a negative timeout waits as long as dequeueBlocking.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * -1: the queue was still empty when the timeout ran out
+ * 0: failure, the queue is closed and empty, or NULL
+ * 1: success
+ */
+int timedDequeueBlocking(BlockingQueue * queue, void ** data, long timeout){
+    if(queue == NULL || data == NULL){
+        return 0;
+    }
+    struct timespec deadline;
+    int result;
+    if(timeout > 0){
+        deadlineBlocking(timeout, &deadline);
+    }
+    pthread_mutex_lock(&queue->lock);
+    while(!queue->closed && queue->queue->length == 0 &&
+          waitBlocking(queue, &queue->notEmpty, timeout, &deadline));
+    if(queue->queue->length > 0){
+        *data = dequeue(queue->queue);
+        pthread_cond_signal(&queue->notFull);
+        result = 1;
+    }
+    else{
+        result = queue->closed ? 0 : -1;
+    }
+    pthread_mutex_unlock(&queue->lock);
+    return result;
+}
+
+/*
+ * Function: closeBlockingQueue
+ * ----------------------------
+ * Closes the queue and wakes every waiting thread.  Once closed, enqueues
+ *      fail and dequeues return the items left in the queue, then fail.
+ *
+ * queue: the queue to close.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int closeBlockingQueue(BlockingQueue * queue){
+    if(queue == NULL){
+        return 0;
+    }
+    pthread_mutex_lock(&queue->lock);
+    queue->closed = 1;
+    pthread_cond_broadcast(&queue->notEmpty);
+    pthread_cond_broadcast(&queue->notFull);
+    pthread_mutex_unlock(&queue->lock);
+    return 1;
+}
+
+/*
+ * Function: lengthBlocking
+ * ----------------------------
+ * returns the number of items in the queue.  The value is a snapshot and
+ *      may be stale by the time it is used if other threads are active.
+ *
+ * queue: the queue to measure.
+ *
+ * return: the number of items in the queue.  -1 if the queue is NULL.
+ */
+int lengthBlocking(BlockingQueue * queue){
+    if(queue == NULL){
+        return -1;
+    }
+    pthread_mutex_lock(&queue->lock);
+    int length = queue->queue->length;
+    pthread_mutex_unlock(&queue->lock);
+    return length;
+}
+
+/*
+ * Function: destroyBlockingQueue
+ * ----------------------------
+ * Frees the queue and all data stored in the queue using the destroyData
+ *      function pointer
+ *
+ * queue: the queue to perform the destroy operation on.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ *
+ * note: No other thread may be using or waiting on the queue when it is
+ *      destroyed.  Close the queue and join its threads first.
+ */
+int destroyBlockingQueue(BlockingQueue * queue){
+    if(queue == NULL){
+        return 0;
+    }
+    destroyQueue(queue->queue);
+    pthread_cond_destroy(&queue->notEmpty);
+    pthread_cond_destroy(&queue->notFull);
+    pthread_mutex_destroy(&queue->lock);
+    free(queue);
+    return 1;
+}
+
+/*
+ * Function: printBlockingQueue
+ * ----------------------------
+ * prints all of the data in the queue as per the printData funtion pointer
+ *
+ * queue: the queue to perform the print operation on.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int printBlockingQueue(BlockingQueue * queue){
+    if(queue == NULL){
+        return 0;
+    }
+    pthread_mutex_lock(&queue->lock);
+    int result = printQueue(queue->queue);
+    pthread_mutex_unlock(&queue->lock);
+    return result;
+}
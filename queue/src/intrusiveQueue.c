@@ -0,0 +1,171 @@
+#include "intrusiveQueue.h"
+
+/*
+ * Function: createIntrusiveQueue
+ * ----------------------------
+ * Creates a pointer to an intrusive queue data structure
+ *
+ * offset: the offset of the QueueLink within the items, e.g.
+ *      offsetof(Job, link).  An item may be in several queues at once
+ *      through different links.
+ * destroyFunc: a function pointer that destroys the items left in the
+ *      queue when it is destroyed.  May be NULL.
+ * printFunc: a function pointer that prints an item.
+ *
+ * return: a pointer to the created queue.  NULL if failed.
+ */
+IntrusiveQueue * createIntrusiveQueue(size_t offset, void (*destroyFunc)(void * data), void (*printFunc)(void * data)){
+    IntrusiveQueue * queue = malloc(sizeof(IntrusiveQueue));
+    if(queue == NULL){
+        return NULL;
+    }
+    queue->head = NULL;
+    queue->tail = NULL;
+    queue->offset = offset;
+    queue->destroyData = destroyFunc;
+    queue->printData = printFunc;
+    queue->length = 0;
+    return queue;
+}
+
+/*
+ * Function: enqueueIntrusive
+ * ----------------------------
+ * Adds an item to the end of the queue
+ *
+ * queue: the queue to perform the enqueue operation on.
+ * data: the item to add.  Its link must not be in use by another queue.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int enqueueIntrusive(IntrusiveQueue * queue, void * data){
+    if(queue == NULL || data == NULL){
+        return 0;
+    }
+    QueueLink * link = (QueueLink *)((char *)data + queue->offset);
+    link->next = NULL;
+    if(queue->tail == NULL){
+        queue->head = link;
+    }
+    else{
+        queue->tail->next = link;
+    }
+    queue->tail = link;
+    queue->length++;
+    return 1;
+}
+
+/*
+ * Function: dequeueIntrusive
+ * ----------------------------
+ * removes the next item in the queue and returns it.  Its link may be
+ *      used to add it to another queue straight away.
+ *
+ * queue: the queue to perform the dequeue operation on.
+ *
+ * return: the item at the front of the queue.  NULL if empty.
+ */
+void * dequeueIntrusive(IntrusiveQueue * queue){
+    if(queue == NULL || queue->head == NULL){
+        return NULL;
+    }
+    QueueLink * link = queue->head;
+    queue->head = link->next;
+    if(queue->head == NULL){
+        queue->tail = NULL;
+    }
+    link->next = NULL;
+    queue->length--;
+    return (char *)link - queue->offset;
+}
+
+/*
+ * Function: concatIntrusiveQueue
+ * ----------------------------
+ * Moves every item of src to the end of dest in O(1), leaving src empty.
+ *
+ * dest: the queue to add the items to.
+ * src: the queue to take the items from.  Must use the same link offset.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int concatIntrusiveQueue(IntrusiveQueue * dest, IntrusiveQueue * src){
+    if(dest == NULL || src == NULL || dest == src || dest->offset != src->offset){
+        return 0;
+    }
+    if(src->head == NULL){
+        return 1;
+    }
+    if(dest->tail == NULL){
+        dest->head = src->head;
+    }
+    else{
+        dest->tail->next = src->head;
+    }
+    dest->tail = src->tail;
+    dest->length += src->length;
+    src->head = NULL;
+    src->tail = NULL;
+    src->length = 0;
+    return 1;
+}
+
+/*
+ * Function: destroyIntrusiveQueue
+ * ----------------------------
+ * Frees the queue, and the items left in it if it has a destroyData.
+ *
+ * queue: the queue to perform the destroy operation on.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int destroyIntrusiveQueue(IntrusiveQueue * queue){
+    if(queue == NULL){
+        return 0;
+    }
+    QueueLink * link = queue->head;
+    QueueLink * temp;
+    while(link != NULL){
+        temp = link->next;
+        if(queue->destroyData != NULL){
+            queue->destroyData((char *)link - queue->offset);
+        }
+        link = temp;
+    }
+    free(queue);
+    return 1;
+}
+
+/*
+ * Function: printIntrusiveQueue
+ * ----------------------------
+ * prints all of the items in the queue as per the printData funtion pointer
+ *
+ * queue: the queue to perform the print operation on.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ *
+ */
+int printIntrusiveQueue(IntrusiveQueue * queue){
+    if(queue == NULL){
+        return 0;
+    }
+    if(queue->length == 0){
+        printf("Queue is Empty\n");
+        return 1;
+    }
+    int i = 1;
+    for(QueueLink * link = queue->head; link != NULL; link = link->next){
+        printf("Entry #%d:\n", i++);
+        queue->printData((char *)link - queue->offset);
+    }
+    return 1;
+}
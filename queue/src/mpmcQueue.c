@@ -0,0 +1,290 @@
+#include <sched.h>
+#include "mpmcQueue.h"
+
+/**internal functions**/
+
+#define MPMC_SPIN_LIMIT 64
+
+/*
+ * Function: backoffMPMC
+ * ----------------------------
+ * waits before a blocking operation retries.  Spins for a short while
+ *      and then yields the processor to let the other side make progress.
+ *
+ * spins: the number of times the caller has retried so far.
+ */
+void backoffMPMC(int spins){
+    if(spins < MPMC_SPIN_LIMIT){
+        atomic_signal_fence(memory_order_seq_cst);
+    }
+    else{
+        sched_yield();
+    }
+}
+
+/**end internal functions**/
+
+/*
+ * Function: createMPMCQueue
+ * ----------------------------
+ * Creates a pointer to a multi producer multi consumer queue
+ *
+ * capacity: the maximum number of items the queue holds.  Rounded up to a
+ *      power of two.
+ * destroyFunc: a function pointer that destroys the data type intended
+ *      to be stored in the queue
+ * printFunc: a function pointer that prints the data type intended to
+ *      be stored in the queue
+ *
+ * return: a pointer to the created queue.  NULL if failed.
+ *
+ * implementation details: every slot starts with a sequence equal to its
+ *      index so the first lap of producers finds each slot free.
+ */
+MPMCQueue * createMPMCQueue(int capacity, void (*destroyFunc)(void * data), void(*printFunc)(void * data)){
+    size_t size = 2;
+    if(capacity < 1){
+        return NULL;
+    }
+    while(size < (size_t)capacity){
+        size *= 2;
+    }
+    MPMCQueue * queue = aligned_alloc(MPMC_CACHE_LINE, sizeof(MPMCQueue));
+    if(queue == NULL){
+        return NULL;
+    }
+    queue->buffer = malloc(sizeof(MPMCSlot) * size);
+    if(queue->buffer == NULL){
+        free(queue);
+        return NULL;
+    }
+    for(size_t i = 0; i < size; i++){
+        atomic_init(&queue->buffer[i].sequence, i);
+        queue->buffer[i].data = NULL;
+    }
+    queue->mask = size - 1;
+    queue->destroyData = destroyFunc;
+    queue->printData = printFunc;
+    atomic_init(&queue->enqueuePos, 0);
+    atomic_init(&queue->dequeuePos, 0);
+    return queue;
+}
+
+/*
+ * Function: tryEnqueueMPMC
+ * ----------------------------
+ * Adds new data to the end of the queue if there is room.  Safe to call
+ *      from any number of threads.
+ *
+ * queue: the queue to perform the enqueue operation on.
+ * data: the data to added to the end of the queue.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure, the queue is full
+ * 1: success
+ *
+ * implementation details: a producer claims a position by advancing
+ *      enqueuePos with a compare and swap once the slot's sequence shows it
+ *      has been emptied.  Publishing sequence = position + 1 hands the slot
+ *      to the consumer that claims the same position.
+ */
+int tryEnqueueMPMC(MPMCQueue * queue, void * data){
+    if(queue == NULL){
+        return 0;
+    }
+    MPMCSlot * slot;
+    size_t pos = atomic_load_explicit(&queue->enqueuePos, memory_order_relaxed);
+    for(;;){
+        slot = &queue->buffer[pos & queue->mask];
+        size_t sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        ptrdiff_t diff = (ptrdiff_t)sequence - (ptrdiff_t)pos;
+        if(diff == 0){
+            if(atomic_compare_exchange_weak_explicit(&queue->enqueuePos, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed)){
+                break;
+            }
+        }
+        else if(diff < 0){
+            return 0;
+        }
+        else{
+            pos = atomic_load_explicit(&queue->enqueuePos, memory_order_relaxed);
+        }
+    }
+    slot->data = data;
+    atomic_store_explicit(&slot->sequence, pos + 1, memory_order_release);
+    return 1;
+}
+
+/*
+ * Function: tryDequeueMPMC
+ * ----------------------------
+ * removes the next value in the queue if there is one.  Safe to call
+ *      from any number of threads.
+ *
+ * queue: the queue to perform the dequeue operation on.
+ * data: set to the removed data on success.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure, the queue is empty
+ * 1: success
+ *
+ * implementation details: a consumer claims a position once the slot's
+ *      sequence shows it has been filled, then sets the sequence one lap
+ *      ahead so the producer of the next lap may reuse the slot.
+ */
+int tryDequeueMPMC(MPMCQueue * queue, void ** data){
+    if(queue == NULL || data == NULL){
+        return 0;
+    }
+    MPMCSlot * slot;
+    size_t pos = atomic_load_explicit(&queue->dequeuePos, memory_order_relaxed);
+    for(;;){
+        slot = &queue->buffer[pos & queue->mask];
+        size_t sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        ptrdiff_t diff = (ptrdiff_t)sequence - (ptrdiff_t)(pos + 1);
+        if(diff == 0){
+            if(atomic_compare_exchange_weak_explicit(&queue->dequeuePos, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed)){
+                break;
+            }
+        }
+        else if(diff < 0){
+            return 0;
+        }
+        else{
+            pos = atomic_load_explicit(&queue->dequeuePos, memory_order_relaxed);
+        }
+    }
+    *data = slot->data;
+    atomic_store_explicit(&slot->sequence, pos + queue->mask + 1, memory_order_release);
+    return 1;
+}
+
+/*
+ * Function: enqueueMPMC
+ * ----------------------------
+ * Adds new data to the end of the queue, waiting for room if the queue
+ *      is full.
+ *
+ * queue: the queue to perform the enqueue operation on.
+ * data: the data to added to the end of the queue.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int enqueueMPMC(MPMCQueue * queue, void * data){
+    if(queue == NULL){
+        return 0;
+    }
+    for(int spins = 0; !tryEnqueueMPMC(queue, data); spins++){
+        backoffMPMC(spins);
+    }
+    return 1;
+}
+
+/*
+ * Function: dequeueMPMC
+ * ----------------------------
+ * removes the next value in the queue, waiting for one if the queue
+ *      is empty.
+ *
+ * queue: the queue to perform the dequeue operation on.
+ *
+ * return: a void pointer of the data stored in the next position in
+ *     queue.  NULL if the queue is NULL.
+ */
+void * dequeueMPMC(MPMCQueue * queue){
+    void * data;
+    if(queue == NULL){
+        return NULL;
+    }
+    for(int spins = 0; !tryDequeueMPMC(queue, &data); spins++){
+        backoffMPMC(spins);
+    }
+    return data;
+}
+
+/*
+ * Function: lengthMPMC
+ * ----------------------------
+ * returns the number of items in the queue.  The value is a snapshot and
+ *      may be stale by the time it is used if other threads are active.
+ *
+ * queue: the queue to measure.
+ *
+ * return: the number of items in the queue.  -1 if the queue is NULL.
+ */
+int lengthMPMC(MPMCQueue * queue){
+    if(queue == NULL){
+        return -1;
+    }
+    size_t dequeuePos = atomic_load_explicit(&queue->dequeuePos, memory_order_acquire);
+    size_t enqueuePos = atomic_load_explicit(&queue->enqueuePos, memory_order_acquire);
+    ptrdiff_t length = (ptrdiff_t)(enqueuePos - dequeuePos);
+    if(length < 0){
+        return 0;
+    }
+    if((size_t)length > queue->mask + 1){
+        return queue->mask + 1;
+    }
+    return length;
+}
+
+/*
+ * Function: destroyMPMCQueue
+ * ----------------------------
+ * Frees the queue and all data stored in the queue using the destroyData
+ *      function pointer
+ *
+ * queue: the queue to perform the destroy operation on.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ *
+ * note: No other thread may be using the queue when it is destroyed.
+ */
+int destroyMPMCQueue(MPMCQueue * queue){
+    void * data;
+    if(queue == NULL){
+        return 0;
+    }
+    while(tryDequeueMPMC(queue, &data)){
+        if(queue->destroyData != NULL){
+            queue->destroyData(data);
+        }
+    }
+    free(queue->buffer);
+    free(queue);
+    return 1;
+}
+
+/*
+ * Function: printMPMCQueue
+ * ----------------------------
+ * prints all of the data in the queue as per the printData funtion pointer
+ *
+ * queue: the queue to perform the print operation on.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ *
+ * note: No other thread may be using the queue while it is printed.
+ */
+int printMPMCQueue(MPMCQueue * queue){
+    if(queue == NULL){
+        return 0;
+    }
+    size_t pos = atomic_load_explicit(&queue->dequeuePos, memory_order_relaxed);
+    size_t end = atomic_load_explicit(&queue->enqueuePos, memory_order_relaxed);
+    if(pos == end){
+        printf("Queue is Empty\n");
+        return 1;
+    }
+    for(int count = 1; pos != end; pos++, count++){
+        printf("Entry #%d:\n", count);
+        queue->printData(queue->buffer[pos & queue->mask].data);
+    }
+    return 1;
+}
@@ -1,10 +1,43 @@
+#include <string.h>
 #include "queue.h"
 
 /**internal functions**/
 
-QueueNode * createQueueNode(){
-    QueueNode * node = malloc(sizeof(QueueNode));
-    return node;
+/*
+ * Function: growQueue
+ * ----------------------------
+ * doubles the capacity of the ring buffer until it can hold at least
+ *      minCapacity items.
+ * 
+ * queue: the queue to grow.
+ * minCapacity: the number of items the queue must be able to hold.
+ * 
+ * return: 1 if sucessful. 0 if failed.
+ * 
+ * implementation details: the buffer is reallocated and the items that
+ *      wrapped around to the front of the old buffer are moved to the slots
+ *      directly after the old end so the items stay contiguous from head.
+ */
+int growQueue(Queue * queue, int minCapacity){
+    int capacity = queue->capacity;
+    void ** buffer;
+    int wrapped;
+    if(minCapacity <= capacity){
+        return 1;
+    }
+    while(capacity < minCapacity){
+        capacity *= 2;
+    }
+    if((buffer = realloc(queue->buffer, sizeof(void *) * capacity)) == NULL){
+        return 0;
+    }
+    wrapped = queue->head + queue->length - queue->capacity;
+    for(int i = 0; i < wrapped; i++){
+        buffer[queue->capacity + i] = buffer[i];
+    }
+    queue->buffer = buffer;
+    queue->capacity = capacity;
+    return 1;
 }
 
 /**end internal functions**/
@@ -19,18 +52,26 @@ QueueNode * createQueueNode(){
  * printFunc: a function pointer that prints the data type intended to
  *      be stored in the queue
  * 
- * return: a pointer to the created queue
+ * return: a pointer to the created queue.  NULL if failed.
  * 
  * implementation details: initializes the length of the queue to zero,
- *      and the head and the tail to NULL.
+ *      and allocates a ring buffer of QUEUE_INITIAL_CAPACITY slots.
  */
 Queue * createQueue(void (*destroyFunc)(void * data), void(*printFunc)(void * data)){
     Queue * queue = malloc(sizeof(Queue));
+    if(queue == NULL){
+        return NULL;
+    }
+    queue->buffer = malloc(sizeof(void *) * QUEUE_INITIAL_CAPACITY);
+    if(queue->buffer == NULL){
+        free(queue);
+        return NULL;
+    }
+    queue->capacity = QUEUE_INITIAL_CAPACITY;
     queue->destroyData = destroyFunc;
     queue->printData = printFunc;
     queue->length = 0;
-    queue->head = NULL;
-    queue->tail = NULL; 
+    queue->head = 0;
     return queue;
 }
 
@@ -41,29 +82,23 @@ Queue * createQueue(void (*destroyFunc)(void * data), void(*printFunc)(void * da
  * 
  * queue: the queue to perform the dequeue operation on.
  * 
- * return: a void pointer of the data stored in the next position in 
+ * return: a void pointer of the data stored in the next position in
  *     queue.
  * 
  * implementation details: checks if the queue is NULL or empty and
- *      removes the Node stored in the head of the queue.
+ *      removes the item stored in the head slot of the ring buffer.
  */
 void * dequeue(Queue * queue){
     void * data;
-    QueueNode * oldHead;
     if(queue == NULL){
         return NULL;
-    }    
-    if(queue->head == NULL){
+    }
+    if(queue->length == 0){
         return NULL;
     }
+    data = queue->buffer[queue->head];
+    queue->head = (queue->head + 1) & (queue->capacity - 1);
     queue->length--;
-    data = queue->head->data;
-    oldHead = queue->head;
-    queue->head = oldHead->next;
-    if(queue->head == NULL){
-        queue->tail = NULL;
-    }
-    free(oldHead);
     return data;
 }
 
@@ -79,30 +114,81 @@ void * dequeue(Queue * queue){
  * 0: failure
  * 1: success
  * 
- * implementation details: checks if the queue is NULL.  Proceeds to set the
- *      data as the new tail.  If the data is the first to be added to the queue
- *      the head is set equal to the tail.
+ * implementation details: checks if the queue is NULL.  Doubles the ring
+ *      buffer if it is full, then stores the data in the slot after the
+ *      last item.
  */
 int enqueue(Queue * queue, void * data){
-    QueueNode * node;
     if(queue == NULL){
         return 0;
     }
-    if((node = createQueueNode()) == NULL){
+    if(queue->length == queue->capacity && !growQueue(queue, queue->length + 1)){
         return 0;
     }
-    node->data = data;
-    node->next = NULL;
+    queue->buffer[(queue->head + queue->length) & (queue->capacity - 1)] = data;
     queue->length++;
-    if(queue->tail == NULL){
-        queue->tail = node;
-        queue->head = node;
-        return 1;
+    return 1;
+
+}
+
+/*
+ * Function: enqueueBatch
+ * ----------------------------
+ * Adds count items to the end of the queue in order.  The ring buffer is
+ *      grown once for the whole batch and the items are copied in at most
+ *      two blocks.
+ * 
+ * queue: the queue to perform the enqueue operation on.
+ * items: the data to be added, first item first.
+ * count: the number of items.
+ * 
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure, no items were added
+ * 1: success
+ * 
+ * implementation details: the first block fills the slots from the end of
+ *      the queue up to the end of the buffer and the second block wraps
+ *      around to the start of the buffer.
+ */
+int enqueueBatch(Queue * queue, void ** items, int count){
+    if(queue == NULL || count < 0 || (items == NULL && count > 0)){
+        return 0;
+    }
+    if(!growQueue(queue, queue->length + count)){
+        return 0;
     }
-    queue->tail->next=node;
-    queue->tail = node;
+    int tail = (queue->head + queue->length) & (queue->capacity - 1);
+    int first = queue->capacity - tail < count ? queue->capacity - tail : count;
+    memcpy(queue->buffer + tail, items, sizeof(void *) * first);
+    memcpy(queue->buffer, items + first, sizeof(void *) * (count - first));
+    queue->length += count;
     return 1;
+}
 
+/*
+ * Function: dequeueBatch
+ * ----------------------------
+ * removes up to count items from the front of the queue into an array.
+ * 
+ * queue: the queue to perform the dequeue operation on.
+ * items: filled with the removed data, front of the queue first.
+ * count: the size of items.
+ * 
+ * return: the number of items removed.  0 if the queue is NULL or empty.
+ */
+int dequeueBatch(Queue * queue, void ** items, int count){
+    if(queue == NULL || items == NULL || count <= 0){
+        return 0;
+    }
+    if(count > queue->length){
+        count = queue->length;
+    }
+    int first = queue->capacity - queue->head < count ? queue->capacity - queue->head : count;
+    memcpy(items, queue->buffer + queue->head, sizeof(void *) * first);
+    memcpy(items + first, queue->buffer, sizeof(void *) * (count - first));
+    queue->head = (queue->head + count) & (queue->capacity - 1);
+    queue->length -= count;
+    return count;
 }
 
 /*
@@ -122,23 +208,19 @@ int enqueue(Queue * queue, void * data){
  *      the queue.
  * 
  * implementation details: This functions loops throught the queue freeing the
- *      data and nodes.  Once finished it frees the queue itself.
+ *      data.  Once finished it frees the ring buffer and the queue itself.
  */
 int destroyQueue(Queue * queue){
     if(queue == NULL){
         return 0;
     }
-    
-    QueueNode * node = queue->head;
-    QueueNode * temp;
-    while(node != NULL){
-        if(queue->destroyData != NULL){
-            queue->destroyData(node->data);
+
+    if(queue->destroyData != NULL){
+        for(int i = 0; i < queue->length; i++){
+            queue->destroyData(queue->buffer[(queue->head + i) & (queue->capacity - 1)]);
         }
-        temp = node->next;
-        free(node);
-        node = temp;
     }
+    free(queue->buffer);
     free(queue);
     return 1;
 }
@@ -156,23 +238,119 @@ int destroyQueue(Queue * queue){
  * 
  * implementation details: iterates through the queue printing each piece
  *      of data.
- *
+ * 
  */
 int printQueue(Queue * queue){
     if(queue == NULL){
         return 0;
     }
-    if(queue->head == NULL){
+    if(queue->length == 0){
         printf("Queue is Empty\n");
         return 1;
     }
-    QueueNode * node = queue->head;
-    int count = 1;
-    while(node != NULL){
-        printf("Entry #%d:\n", count);
-        queue->printData(node->data);
-        count++;
-        node = node->next;
+    for(int i = 0; i < queue->length; i++){
+        printf("Entry #%d:\n", i + 1);
+        queue->printData(queue->buffer[(queue->head + i) & (queue->capacity - 1)]);
     }
     return 1;
 }
+
+/*
+ * Function: iterBeginQueue
+ * ----------------------------
+ * Creates an iterator positioned at the front of the queue, the next item
+ *      to be dequeued.
+ * 
+ * queue: the queue to iterate over.
+ * 
+ * return: an iterator on the front item.  The iterator is not valid if the
+ *      queue is empty or NULL.
+ */
+QueueIterator iterBeginQueue(Queue * queue){
+    QueueIterator iterator;
+    iterator.queue = queue;
+    iterator.position = 0;
+    return iterator;
+}
+
+/*
+ * Function: iterEndQueue
+ * ----------------------------
+ * Creates an iterator positioned at the back of the queue, the item most
+ *      recently enqueued, for walking the queue backwards.
+ * 
+ * queue: the queue to iterate over.
+ * 
+ * return: an iterator on the back item.  The iterator is not valid if the
+ *      queue is empty or NULL.
+ */
+QueueIterator iterEndQueue(Queue * queue){
+    QueueIterator iterator;
+    iterator.queue = queue;
+    iterator.position = queue == NULL ? -1 : queue->length - 1;
+    return iterator;
+}
+
+/*
+ * Function: iterValidQueue
+ * ----------------------------
+ * Checks whether the iterator is positioned on an item.
+ * 
+ * iterator: the iterator to check.
+ * 
+ * return: 1 if the iterator is on an item. 0 if it has run off either end.
+ */
+int iterValidQueue(QueueIterator * iterator){
+    return iterator != NULL && iterator->queue != NULL && iterator->position >= 0 && iterator->position < iterator->queue->length;
+}
+
+/*
+ * Function: iterGetQueue
+ * ----------------------------
+ * retrieve the item the iterator is positioned on.
+ * 
+ * iterator: the iterator to read.
+ * 
+ * return: a pointer of the data at the iterator.  NULL if not valid.
+ */
+void * iterGetQueue(QueueIterator * iterator){
+    if(!iterValidQueue(iterator)){
+        return NULL;
+    }
+    Queue * queue = iterator->queue;
+    return queue->buffer[(queue->head + iterator->position) & (queue->capacity - 1)];
+}
+
+/*
+ * Function: iterNextQueue
+ * ----------------------------
+ * moves the iterator one item towards the back of the queue.
+ * 
+ * iterator: the iterator to move.
+ * 
+ * return: 1 if the iterator is on an item after moving. 0 otherwise.
+ */
+int iterNextQueue(QueueIterator * iterator){
+    if(!iterValidQueue(iterator)){
+        return 0;
+    }
+    iterator->position++;
+    return iterValidQueue(iterator);
+}
+
+/*
+ * Function: iterPrevQueue
+ * ----------------------------
+ * moves the iterator one item towards the front of the queue.
+ * 
+ * iterator: the iterator to move.
+ * 
+ * return: 1 if the iterator is on an item after moving. 0 otherwise.
+ */
+int iterPrevQueue(QueueIterator * iterator){
+    if(!iterValidQueue(iterator)){
+        return 0;
+    }
+    iterator->position--;
+    return iterValidQueue(iterator);
+}
@@ -0,0 +1,335 @@
+#include <sched.h>
+#include <string.h>
+#include "spscQueue.h"
+
+#define SPSC_SPIN_LIMIT 64
+
+/**internal functions**/
+
+/*
+ * Function: backoffSPSC
+ * ----------------------------
+ * waits before a blocking operation retries.  Spins for a short while
+ *      and then yields the processor to let the other side make progress.
+ *
+ * spins: the number of times the caller has retried so far.
+ */
+void backoffSPSC(int spins){
+    if(spins < SPSC_SPIN_LIMIT){
+        atomic_signal_fence(memory_order_seq_cst);
+    }
+    else{
+        sched_yield();
+    }
+}
+
+/*
+ * Function: roomSPSC
+ * ----------------------------
+ * returns the number of free slots the producer can write at tail,
+ *      reading head again only if the cached copy shows fewer than wanted.
+ */
+size_t roomSPSC(SPSCQueue * queue, size_t tail, size_t wanted){
+    size_t room = queue->mask + 1 - (tail - queue->cachedHead);
+    if(room < wanted){
+        queue->cachedHead = atomic_load_explicit(&queue->head, memory_order_acquire);
+        room = queue->mask + 1 - (tail - queue->cachedHead);
+    }
+    return room;
+}
+
+/*
+ * Function: readySPSC
+ * ----------------------------
+ * returns the number of items the consumer can read at head, reading tail
+ *      again only if the cached copy shows fewer than wanted.
+ */
+size_t readySPSC(SPSCQueue * queue, size_t head, size_t wanted){
+    size_t ready = queue->cachedTail - head;
+    if(ready < wanted){
+        queue->cachedTail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+        ready = queue->cachedTail - head;
+    }
+    return ready;
+}
+
+/**end internal functions**/
+
+/*
+ * Function: createSPSCQueue
+ * ----------------------------
+ * Creates a pointer to a single producer single consumer queue
+ *
+ * capacity: the maximum number of items the queue holds.  Rounded up to a
+ *      power of two.
+ * destroyFunc: a function pointer that destroys the data type intended
+ *      to be stored in the queue
+ * printFunc: a function pointer that prints the data type intended to
+ *      be stored in the queue
+ *
+ * return: a pointer to the created queue.  NULL if failed.
+ */
+SPSCQueue * createSPSCQueue(int capacity, void (*destroyFunc)(void * data), void(*printFunc)(void * data)){
+    size_t size = 2;
+    if(capacity < 1){
+        return NULL;
+    }
+    while(size < (size_t)capacity){
+        size *= 2;
+    }
+    SPSCQueue * queue = aligned_alloc(SPSC_CACHE_LINE, sizeof(SPSCQueue));
+    if(queue == NULL){
+        return NULL;
+    }
+    queue->buffer = malloc(sizeof(void *) * size);
+    if(queue->buffer == NULL){
+        free(queue);
+        return NULL;
+    }
+    queue->mask = size - 1;
+    queue->destroyData = destroyFunc;
+    queue->printData = printFunc;
+    atomic_init(&queue->tail, 0);
+    atomic_init(&queue->head, 0);
+    queue->cachedHead = 0;
+    queue->cachedTail = 0;
+    return queue;
+}
+
+/*
+ * Function: tryEnqueueSPSC
+ * ----------------------------
+ * Adds new data to the end of the queue if there is room.  Only the
+ *      producer thread may call it.
+ *
+ * queue: the queue to perform the enqueue operation on.
+ * data: the data to added to the end of the queue.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure, the queue is full
+ * 1: success
+ */
+int tryEnqueueSPSC(SPSCQueue * queue, void * data){
+    if(queue == NULL){
+        return 0;
+    }
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    if(roomSPSC(queue, tail, 1) == 0){
+        return 0;
+    }
+    queue->buffer[tail & queue->mask] = data;
+    atomic_store_explicit(&queue->tail, tail + 1, memory_order_release);
+    return 1;
+}
+
+/*
+ * Function: tryDequeueSPSC
+ * ----------------------------
+ * removes the next value in the queue if there is one.  Only the consumer
+ *      thread may call it.
+ *
+ * queue: the queue to perform the dequeue operation on.
+ * data: set to the removed data on success.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure, the queue is empty
+ * 1: success
+ */
+int tryDequeueSPSC(SPSCQueue * queue, void ** data){
+    if(queue == NULL || data == NULL){
+        return 0;
+    }
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    if(readySPSC(queue, head, 1) == 0){
+        return 0;
+    }
+    *data = queue->buffer[head & queue->mask];
+    atomic_store_explicit(&queue->head, head + 1, memory_order_release);
+    return 1;
+}
+
+/*
+ * Function: enqueueBatchSPSC
+ * ----------------------------
+ * Adds as many of count items to the end of the queue as there is room
+ *      for, and publishes them to the consumer at once.  Only the producer
+ *      thread may call it.
+ *
+ * queue: the queue to perform the enqueue operation on.
+ * items: the data to be added, first item first.
+ * count: the number of items.
+ *
+ * return: the number of items added, from the front of items.  0 if the
+ *      queue is full or NULL.
+ */
+int enqueueBatchSPSC(SPSCQueue * queue, void ** items, int count){
+    if(queue == NULL || items == NULL || count <= 0){
+        return 0;
+    }
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    size_t room = roomSPSC(queue, tail, count);
+    size_t added = room < (size_t)count ? room : (size_t)count;
+    if(added == 0){
+        return 0;
+    }
+    size_t start = tail & queue->mask;
+    size_t first = queue->mask + 1 - start < added ? queue->mask + 1 - start : added;
+    memcpy(queue->buffer + start, items, sizeof(void *) * first);
+    memcpy(queue->buffer, items + first, sizeof(void *) * (added - first));
+    atomic_store_explicit(&queue->tail, tail + added, memory_order_release);
+    return added;
+}
+
+/*
+ * Function: dequeueBatchSPSC
+ * ----------------------------
+ * removes up to count items from the front of the queue into an array,
+ *      and hands their slots back to the producer at once.  Only the
+ *      consumer thread may call it.
+ *
+ * queue: the queue to perform the dequeue operation on.
+ * items: filled with the removed data, front of the queue first.
+ * count: the size of items.
+ *
+ * return: the number of items removed.  0 if the queue is empty or NULL.
+ */
+int dequeueBatchSPSC(SPSCQueue * queue, void ** items, int count){
+    if(queue == NULL || items == NULL || count <= 0){
+        return 0;
+    }
+    size_t head = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    size_t ready = readySPSC(queue, head, count);
+    size_t removed = ready < (size_t)count ? ready : (size_t)count;
+    if(removed == 0){
+        return 0;
+    }
+    size_t start = head & queue->mask;
+    size_t first = queue->mask + 1 - start < removed ? queue->mask + 1 - start : removed;
+    memcpy(items, queue->buffer + start, sizeof(void *) * first);
+    memcpy(items + first, queue->buffer, sizeof(void *) * (removed - first));
+    atomic_store_explicit(&queue->head, head + removed, memory_order_release);
+    return removed;
+}
+
+/*
+ * Function: enqueueSPSC
+ * ----------------------------
+ * Adds new data to the end of the queue, waiting for room if the queue
+ *      is full.  Only the producer thread may call it.
+ *
+ * queue: the queue to perform the enqueue operation on.
+ * data: the data to added to the end of the queue.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int enqueueSPSC(SPSCQueue * queue, void * data){
+    if(queue == NULL){
+        return 0;
+    }
+    for(int spins = 0; !tryEnqueueSPSC(queue, data); spins++){
+        backoffSPSC(spins);
+    }
+    return 1;
+}
+
+/*
+ * Function: dequeueSPSC
+ * ----------------------------
+ * removes the next value in the queue, waiting for one if the queue
+ *      is empty.  Only the consumer thread may call it.
+ *
+ * queue: the queue to perform the dequeue operation on.
+ *
+ * return: a void pointer of the data stored in the next position in
+ *     queue.  NULL if the queue is NULL.
+ */
+void * dequeueSPSC(SPSCQueue * queue){
+    void * data = NULL;
+    if(queue == NULL){
+        return NULL;
+    }
+    for(int spins = 0; !tryDequeueSPSC(queue, &data); spins++){
+        backoffSPSC(spins);
+    }
+    return data;
+}
+
+/*
+ * Function: lengthSPSC
+ * ----------------------------
+ * returns the number of items in the queue.  The value is a snapshot and
+ *      may be stale by the time it is used if the other thread is active.
+ *
+ * queue: the queue to measure.
+ *
+ * return: the number of items in the queue.  -1 if the queue is NULL.
+ */
+int lengthSPSC(SPSCQueue * queue){
+    if(queue == NULL){
+        return -1;
+    }
+    size_t head = atomic_load_explicit(&queue->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&queue->tail, memory_order_acquire);
+    return tail - head;
+}
+
+/*
+ * Function: destroySPSCQueue
+ * ----------------------------
+ * Frees the queue and all data stored in the queue using the destroyData
+ *      function pointer
+ *
+ * queue: the queue to perform the destroy operation on.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ *
+ * note: Neither thread may be using the queue when it is destroyed.
+ */
+int destroySPSCQueue(SPSCQueue * queue){
+    void * data;
+    if(queue == NULL){
+        return 0;
+    }
+    while(tryDequeueSPSC(queue, &data)){
+        if(queue->destroyData != NULL){
+            queue->destroyData(data);
+        }
+    }
+    free(queue->buffer);
+    free(queue);
+    return 1;
+}
+
+/*
+ * Function: printSPSCQueue
+ * ----------------------------
+ * prints all of the data in the queue as per the printData funtion pointer
+ *
+ * queue: the queue to perform the print operation on.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ *
+ * note: Neither thread may be using the queue while it is printed.
+ */
+int printSPSCQueue(SPSCQueue * queue){
+    if(queue == NULL){
+        return 0;
+    }
+    size_t pos = atomic_load_explicit(&queue->head, memory_order_relaxed);
+    size_t end = atomic_load_explicit(&queue->tail, memory_order_relaxed);
+    if(pos == end){
+        printf("Queue is Empty\n");
+        return 1;
+    }
+    for(int count = 1; pos != end; pos++, count++){
+        printf("Entry #%d:\n", count);
+        queue->printData(queue->buffer[pos & queue->mask]);
+    }
+    return 1;
+}
@@ -0,0 +1,195 @@
+#include <pthread.h>
+#include <time.h>
+#include "unity.h"
+#include "blockingQueue.h"
+
+#define PRODUCERS 4
+#define CONSUMERS 3
+#define ITEMS_PER_PRODUCER 20000
+#define CAPACITY 8
+
+void noDestroyFunc(void * data){
+}
+
+void printFunc(void * data){
+    printf("%d", *(int*)data);
+}
+
+void setUp(void) {
+    // set stuff up here
+
+}
+
+void tearDown(void) {
+    // clean stuff up here
+}
+
+/*
+ * Function: elapsedMs
+ * ----------------------------
+ * returns the milliseconds on the monotonic clock since start.
+ */
+double elapsedMs(struct timespec * start){
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start->tv_sec) * 1e3 + (now.tv_nsec - start->tv_nsec) / 1e6;
+}
+
+/*
+ * Test: test_blocking_queue_single_thread
+ * ----------------------------
+ * Test NULL handling, the capacity bound, timeouts and close semantics
+ *      from a single thread.
+ */
+void test_blocking_queue_single_thread(void){
+    BlockingQueue * queue = createBlockingQueue(2, &noDestroyFunc, &printFunc);
+    int values[3] = {1, 2, 3};
+    void * data;
+    struct timespec start;
+    TEST_ASSERT_NOT_NULL_MESSAGE(queue, "createBlockingQueue returned NULL");
+    TEST_ASSERT_NULL_MESSAGE(createBlockingQueue(0, &noDestroyFunc, &printFunc), "zero capacity queue created");
+    TEST_ASSERT_EQUAL_INT(0, enqueueBlocking(NULL, &values[0]));
+    TEST_ASSERT_EQUAL_INT(0, dequeueBlocking(NULL, &data));
+    TEST_ASSERT_EQUAL_INT(-1, lengthBlocking(NULL));
+
+    TEST_ASSERT_EQUAL_INT_MESSAGE(-1, timedDequeueBlocking(queue, &data, 0), "empty dequeue did not time out");
+    TEST_ASSERT_EQUAL_INT(1, enqueueBlocking(queue, &values[0]));
+    TEST_ASSERT_EQUAL_INT(1, timedEnqueueBlocking(queue, &values[1], 0));
+    TEST_ASSERT_EQUAL_INT_MESSAGE(-1, timedEnqueueBlocking(queue, &values[2], 0), "enqueue past capacity did not time out");
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    TEST_ASSERT_EQUAL_INT(-1, timedEnqueueBlocking(queue, &values[2], 30));
+    TEST_ASSERT_MESSAGE(elapsedMs(&start) >= 29, "timed enqueue returned before its timeout");
+    TEST_ASSERT_EQUAL_INT(2, lengthBlocking(queue));
+
+    TEST_ASSERT_EQUAL_INT(1, closeBlockingQueue(queue));
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, timedEnqueueBlocking(queue, &values[2], 10), "enqueue on a closed queue succeeded");
+    TEST_ASSERT_EQUAL_INT(1, dequeueBlocking(queue, &data));
+    TEST_ASSERT_EQUAL_PTR(&values[0], data);
+    TEST_ASSERT_EQUAL_INT(1, timedDequeueBlocking(queue, &data, 10));
+    TEST_ASSERT_EQUAL_PTR(&values[1], data);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, dequeueBlocking(queue, &data), "dequeue on a closed empty queue did not fail");
+    TEST_ASSERT_EQUAL_INT(0, destroyBlockingQueue(NULL));
+    TEST_ASSERT_EQUAL_INT(1, destroyBlockingQueue(queue));
+}
+
+BlockingQueue * sharedQueue;
+int consumed[PRODUCERS * ITEMS_PER_PRODUCER];
+int overfull;
+
+void * producer(void * arg){
+    int first = *(int*)arg * ITEMS_PER_PRODUCER;
+    for(int i = 0; i < ITEMS_PER_PRODUCER; i++){
+        if(i % 2 == 0){
+            enqueueBlocking(sharedQueue, &consumed[first + i]);
+        }
+        else{
+            while(timedEnqueueBlocking(sharedQueue, &consumed[first + i], 1) == -1);
+        }
+    }
+    return NULL;
+}
+
+void * consumer(void * arg){
+    void * data;
+    int result;
+    while((result = timedDequeueBlocking(sharedQueue, &data, 1)) != 0){
+        if(result == 1){
+            __atomic_fetch_add((int*)data, 1, __ATOMIC_RELAXED);
+        }
+        if(lengthBlocking(sharedQueue) > CAPACITY){
+            overfull = 1;
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Test: test_blocking_queue_producers_consumers
+ * ----------------------------
+ * Test that every item is consumed exactly once by several consumers
+ *      while several producers are held back by a small capacity, and that
+ *      closing the queue lets the consumers finish.
+ */
+void test_blocking_queue_producers_consumers(void){
+    pthread_t producers[PRODUCERS];
+    pthread_t consumers[CONSUMERS];
+    int ids[PRODUCERS];
+    sharedQueue = createBlockingQueue(CAPACITY, &noDestroyFunc, &printFunc);
+    overfull = 0;
+    for(int i = 0; i < CONSUMERS; i++){
+        pthread_create(&consumers[i], NULL, &consumer, NULL);
+    }
+    for(int i = 0; i < PRODUCERS; i++){
+        ids[i] = i;
+        pthread_create(&producers[i], NULL, &producer, &ids[i]);
+    }
+    for(int i = 0; i < PRODUCERS; i++){
+        pthread_join(producers[i], NULL);
+    }
+    closeBlockingQueue(sharedQueue);
+    for(int i = 0; i < CONSUMERS; i++){
+        pthread_join(consumers[i], NULL);
+    }
+    for(int i = 0; i < PRODUCERS * ITEMS_PER_PRODUCER; i++){
+        if(consumed[i] != 1){
+            TEST_FAIL_MESSAGE("an item was not consumed exactly once");
+        }
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, overfull, "queue grew past its capacity");
+    TEST_ASSERT_EQUAL_INT(0, lengthBlocking(sharedQueue));
+    destroyBlockingQueue(sharedQueue);
+}
+
+void * blockedProducer(void * arg){
+    static int value;
+    *(int*)arg = enqueueBlocking(sharedQueue, &value);
+    return NULL;
+}
+
+void * blockedConsumer(void * arg){
+    void * data;
+    *(int*)arg = dequeueBlocking(sharedQueue, &data);
+    return NULL;
+}
+
+/*
+ * Test: test_blocking_queue_close_wakes_waiters
+ * ----------------------------
+ * Test that closing a queue wakes threads blocked in enqueue on a full
+ *      queue and in dequeue on an empty queue.
+ */
+void test_blocking_queue_close_wakes_waiters(void){
+    pthread_t threads[2];
+    int results[2] = {-2, -2};
+    struct timespec pause = {0, 20000000};
+    int value;
+    BlockingQueue * empty = createBlockingQueue(1, &noDestroyFunc, &printFunc);
+    sharedQueue = empty;
+    pthread_create(&threads[0], NULL, &blockedConsumer, &results[0]);
+    nanosleep(&pause, NULL);
+    closeBlockingQueue(empty);
+    pthread_join(threads[0], NULL);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, results[0], "blocked dequeue not failed by close");
+
+    sharedQueue = createBlockingQueue(1, &noDestroyFunc, &printFunc);
+    enqueueBlocking(sharedQueue, &value);
+    pthread_create(&threads[1], NULL, &blockedProducer, &results[1]);
+    nanosleep(&pause, NULL);
+    closeBlockingQueue(sharedQueue);
+    pthread_join(threads[1], NULL);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, results[1], "blocked enqueue not failed by close");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, lengthBlocking(sharedQueue), "close dropped an item");
+    destroyBlockingQueue(sharedQueue);
+    destroyBlockingQueue(empty);
+}
+
+int main(void) {
+
+    UNITY_BEGIN();
+
+    RUN_TEST(test_blocking_queue_single_thread);
+    RUN_TEST(test_blocking_queue_producers_consumers);
+    RUN_TEST(test_blocking_queue_close_wakes_waiters);
+
+    return UNITY_END();
+}
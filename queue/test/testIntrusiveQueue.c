@@ -0,0 +1,127 @@
+#include "unity.h"
+#include "intrusiveQueue.h"
+
+/*
+ * Struct: Job
+ * ----------------------------
+ * An item with two queue links, so it can wait in a work queue and a
+ *      retry queue at the same time.
+ */
+typedef struct job{
+    int id;
+    QueueLink work;
+    QueueLink retry;
+}Job;
+
+int destroyed;
+
+void countDestroy(void * data){
+    destroyed++;
+}
+
+void printJob(void * data){
+    printf("job %d\n", ((Job *)data)->id);
+}
+
+void setUp(void) {
+    // set stuff up here
+    destroyed = 0;
+}
+
+void tearDown(void) {
+    // clean stuff up here
+}
+
+/*
+ * Test: test_intrusive_queue_null
+ * ----------------------------
+ * Test that the intrusive queue functions handle NULL and empty queues.
+ */
+void test_intrusive_queue_null(void){
+    IntrusiveQueue * queue = createIntrusiveQueue(offsetof(Job, work), NULL, &printJob);
+    IntrusiveQueue * other = createIntrusiveQueue(offsetof(Job, retry), NULL, &printJob);
+    Job job = {1};
+    TEST_ASSERT_NOT_NULL_MESSAGE(queue, "createIntrusiveQueue returned NULL");
+    TEST_ASSERT_EQUAL_INT(0, enqueueIntrusive(NULL, &job));
+    TEST_ASSERT_EQUAL_INT(0, enqueueIntrusive(queue, NULL));
+    TEST_ASSERT_NULL(dequeueIntrusive(NULL));
+    TEST_ASSERT_NULL(dequeueIntrusive(queue));
+    TEST_ASSERT_EQUAL_INT(0, concatIntrusiveQueue(queue, NULL));
+    TEST_ASSERT_EQUAL_INT(0, concatIntrusiveQueue(queue, queue));
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, concatIntrusiveQueue(queue, other), "concat of queues using different links succeeded");
+    TEST_ASSERT_EQUAL_INT(1, printIntrusiveQueue(queue));
+    TEST_ASSERT_EQUAL_INT(0, destroyIntrusiveQueue(NULL));
+    TEST_ASSERT_EQUAL_INT(1, destroyIntrusiveQueue(queue));
+    TEST_ASSERT_EQUAL_INT(1, destroyIntrusiveQueue(other));
+}
+
+/*
+ * Test: test_intrusive_queue_order
+ * ----------------------------
+ * Test that items come out in the order they went in, and that the queue
+ *      can be emptied and refilled.
+ */
+void test_intrusive_queue_order(void){
+    Job jobs[100];
+    IntrusiveQueue * queue = createIntrusiveQueue(offsetof(Job, work), NULL, &printJob);
+    for(int round = 0; round < 3; round++){
+        for(int i = 0; i < 100; i++){
+            jobs[i].id = i;
+            TEST_ASSERT_EQUAL_INT(1, enqueueIntrusive(queue, &jobs[i]));
+        }
+        TEST_ASSERT_EQUAL_INT(100, queue->length);
+        for(int i = 0; i < 100; i++){
+            TEST_ASSERT_EQUAL_PTR_MESSAGE(&jobs[i], dequeueIntrusive(queue), "dequeued out of order");
+        }
+        TEST_ASSERT_NULL(dequeueIntrusive(queue));
+        TEST_ASSERT_EQUAL_INT(0, queue->length);
+        TEST_ASSERT_NULL_MESSAGE(queue->tail, "tail not cleared once empty");
+    }
+    destroyIntrusiveQueue(queue);
+}
+
+/*
+ * Test: test_intrusive_queue_move
+ * ----------------------------
+ * Test moving items between queues by dequeue and enqueue and by concat,
+ *      items in two queues at once, and destroyData on destroy.
+ */
+void test_intrusive_queue_move(void){
+    Job jobs[10];
+    IntrusiveQueue * work = createIntrusiveQueue(offsetof(Job, work), NULL, &printJob);
+    IntrusiveQueue * done = createIntrusiveQueue(offsetof(Job, work), NULL, &printJob);
+    IntrusiveQueue * retry = createIntrusiveQueue(offsetof(Job, retry), &countDestroy, &printJob);
+    for(int i = 0; i < 10; i++){
+        jobs[i].id = i;
+        enqueueIntrusive(work, &jobs[i]);
+    }
+    for(int i = 0; i < 4; i++){
+        Job * job = dequeueIntrusive(work);
+        enqueueIntrusive(done, job);
+        enqueueIntrusive(retry, job);
+    }
+    TEST_ASSERT_EQUAL_INT(1, concatIntrusiveQueue(done, work));
+    TEST_ASSERT_EQUAL_INT(0, work->length);
+    TEST_ASSERT_NULL(dequeueIntrusive(work));
+    TEST_ASSERT_EQUAL_INT(10, done->length);
+    for(int i = 0; i < 10; i++){
+        TEST_ASSERT_EQUAL_PTR_MESSAGE(&jobs[i], dequeueIntrusive(done), "concatenated queue out of order");
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(4, retry->length, "second link disturbed by the first");
+    TEST_ASSERT_EQUAL_PTR(&jobs[0], dequeueIntrusive(retry));
+    destroyIntrusiveQueue(work);
+    destroyIntrusiveQueue(done);
+    destroyIntrusiveQueue(retry);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(3, destroyed, "destroyData not called for each item left");
+}
+
+int main(void) {
+
+    UNITY_BEGIN();
+
+    RUN_TEST(test_intrusive_queue_null);
+    RUN_TEST(test_intrusive_queue_order);
+    RUN_TEST(test_intrusive_queue_move);
+
+    return UNITY_END();
+}
@@ -0,0 +1,176 @@
+#include <pthread.h>
+#include "unity.h"
+#include "mpmcQueue.h"
+
+#define PRODUCERS 4
+#define CONSUMERS 4
+#define ITEMS_PER_PRODUCER 100000
+
+/*
+ * Struct: TestStruct
+ * ----------------------------
+ * A data structure used for testing
+ */
+typedef struct testingStruct{
+    int num;
+    char letter;
+}TestStruct;
+
+/*
+ * Function: createTestingStruct
+ * ----------------------------
+ * Allocates and sets a structure used for testing the MPMCQueue data structure.
+ * 
+ * Created to keep DRY (Don't Repeated Yourself)
+ */
+TestStruct * createTestingStruct(int num, char c){
+    TestStruct * test = malloc(sizeof(TestStruct));
+    test->num = num;
+    test->letter = c;
+    return test;
+}
+
+void destroyFunc(void * data){
+    free(data);
+}
+
+void printFunc(void * data){
+    printf("%c%d", ((TestStruct*)data)->letter, ((TestStruct*)data)->num);
+}
+
+void setUp(void) {
+    // set stuff up here
+
+}
+
+void tearDown(void) {
+    // clean stuff up here
+}
+
+/*
+ * Test: test_create_mpmc_queue
+ * ----------------------------
+ * Ensure the createMPMCQueue function rounds the capacity to a power of two
+ */
+void test_create_mpmc_queue(void){
+    MPMCQueue * queue = createMPMCQueue(100, &destroyFunc, &printFunc);
+    TEST_ASSERT_NOT_NULL_MESSAGE(queue, "createMPMCQueue returned null pointer");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(127, queue->mask, "capacity not rounded to a power of two");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, lengthMPMC(queue), "queue length not zero");
+    TEST_ASSERT_NULL_MESSAGE(createMPMCQueue(0, &destroyFunc, &printFunc), "zero capacity queue created");
+    destroyMPMCQueue(queue);
+}
+
+/*
+ * Test: test_null_mpmc_queue
+ * ----------------------------
+ * Test that a NULL queue is handled gracefully
+ */
+void test_null_mpmc_queue(void){
+    void * data;
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, tryEnqueueMPMC(NULL, NULL), "NULL enqueue did not fail");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, tryDequeueMPMC(NULL, &data), "NULL dequeue did not fail");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, enqueueMPMC(NULL, NULL), "NULL blocking enqueue did not fail");
+    TEST_ASSERT_NULL_MESSAGE(dequeueMPMC(NULL), "NULL blocking dequeue did not return NULL");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, destroyMPMCQueue(NULL), "NULL destroy did not fail");
+}
+
+/*
+ * Test: test_mpmc_full_and_empty
+ * ----------------------------
+ * Test that try enqueue fails when full, try dequeue fails when empty, and
+ *      the items come out in FIFO order across several laps of the ring.
+ */
+void test_mpmc_full_and_empty(void){
+    MPMCQueue * queue = createMPMCQueue(4, &destroyFunc, &printFunc);
+    TestStruct * test = createTestingStruct(0, 'a');
+    void * data;
+    int next = 0;
+
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, tryDequeueMPMC(queue, &data), "empty dequeue did not fail");
+    for(int lap = 0; lap < 3; lap++){
+        for(int i = 0; i < 4; i++){
+            TEST_ASSERT_EQUAL_INT_MESSAGE(1, tryEnqueueMPMC(queue, createTestingStruct(lap * 4 + i, 'a')), "enqueue failed with room");
+        }
+        TEST_ASSERT_EQUAL_INT_MESSAGE(4, lengthMPMC(queue), "length incorrect when full");
+        TEST_ASSERT_EQUAL_INT_MESSAGE(0, tryEnqueueMPMC(queue, test), "enqueue did not fail when full");
+        for(int i = 0; i < 4; i++){
+            TEST_ASSERT_EQUAL_INT_MESSAGE(1, tryDequeueMPMC(queue, &data), "dequeue failed with items");
+            TEST_ASSERT_EQUAL_INT_MESSAGE(next, ((TestStruct*)data)->num, "dequeue out of order");
+            free(data);
+            next++;
+        }
+        TEST_ASSERT_EQUAL_INT_MESSAGE(0, tryDequeueMPMC(queue, &data), "empty dequeue did not fail");
+    }
+    tryEnqueueMPMC(queue, test);
+    destroyMPMCQueue(queue);
+}
+
+MPMCQueue * sharedQueue;
+int consumed[PRODUCERS * ITEMS_PER_PRODUCER];
+
+void * producer(void * arg){
+    int first = *(int*)arg * ITEMS_PER_PRODUCER;
+    for(int i = 0; i < ITEMS_PER_PRODUCER; i++){
+        enqueueMPMC(sharedQueue, &consumed[first + i]);
+    }
+    return NULL;
+}
+
+void * consumer(void * arg){
+    int * slot;
+    (void)arg;
+    for(int i = 0; i < PRODUCERS * ITEMS_PER_PRODUCER / CONSUMERS; i++){
+        slot = dequeueMPMC(sharedQueue);
+        (*slot)++;
+    }
+    return NULL;
+}
+
+/*
+ * Test: test_mpmc_threads
+ * ----------------------------
+ * Test that every item enqueued by several producers is dequeued exactly
+ *      once by several consumers.
+ */
+void test_mpmc_threads(void){
+    pthread_t producers[PRODUCERS];
+    pthread_t consumers[CONSUMERS];
+    int ids[PRODUCERS];
+    int duplicates = 0;
+    int missing = 0;
+
+    sharedQueue = createMPMCQueue(1024, NULL, &printFunc);
+    for(int i = 0; i < CONSUMERS; i++){
+        pthread_create(&consumers[i], NULL, &consumer, NULL);
+    }
+    for(int i = 0; i < PRODUCERS; i++){
+        ids[i] = i;
+        pthread_create(&producers[i], NULL, &producer, &ids[i]);
+    }
+    for(int i = 0; i < PRODUCERS; i++){
+        pthread_join(producers[i], NULL);
+    }
+    for(int i = 0; i < CONSUMERS; i++){
+        pthread_join(consumers[i], NULL);
+    }
+    for(int i = 0; i < PRODUCERS * ITEMS_PER_PRODUCER; i++){
+        missing += consumed[i] == 0;
+        duplicates += consumed[i] > 1;
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, missing, "items were lost");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, duplicates, "items were dequeued more than once");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, lengthMPMC(sharedQueue), "queue not empty after all items consumed");
+    destroyMPMCQueue(sharedQueue);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    
+    RUN_TEST(test_create_mpmc_queue);
+    RUN_TEST(test_null_mpmc_queue);
+    RUN_TEST(test_mpmc_full_and_empty);
+    RUN_TEST(test_mpmc_threads);
+
+    return UNITY_END();
+}
@@ -174,6 +174,136 @@ void test_large_queue(void){
     destroyQueue(queue);
 }
 
+/*
+ * Test: test_wrapped_growth
+ * ----------------------------
+ * Test that the queue keeps its order when it grows while the items
+ *      wrap around the end of the ring buffer.
+ */
+void test_wrapped_growth(void){
+    Queue * queue = createQueue(&destroyFunc, &printFunc);
+    TestStruct * test;
+    int next = 0;
+    char errorString[100];
+
+    for(int i = 0; i < QUEUE_INITIAL_CAPACITY; i++){
+        enqueue(queue, createTestingStruct(i, 'a'));
+    }
+    for(int i = 0; i < QUEUE_INITIAL_CAPACITY / 2; i++){
+        free(dequeue(queue));
+        next++;
+    }
+    for(int i = 0; i < QUEUE_INITIAL_CAPACITY; i++){
+        enqueue(queue, createTestingStruct(i + QUEUE_INITIAL_CAPACITY, 'a'));
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(QUEUE_INITIAL_CAPACITY * 2, queue->capacity, "queue did not double its capacity");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(QUEUE_INITIAL_CAPACITY + QUEUE_INITIAL_CAPACITY / 2, queue->length, "queue length incorrect after growth");
+    while(queue->length > 0){
+        test = dequeue(queue);
+        sprintf(errorString, "dequeue out of order, expected %d", next);
+        TEST_ASSERT_EQUAL_INT_MESSAGE(next, test->num, errorString);
+        free(test);
+        next++;
+    }
+    destroyQueue(queue);
+}
+
+/*
+ * Test: test_steady_state_capacity
+ * ----------------------------
+ * Test that alternating enqueue and dequeue does not grow the ring buffer.
+ */
+void test_steady_state_capacity(void){
+    Queue * queue = createQueue(&destroyFunc, &printFunc);
+    TestStruct * test;
+    for(int i = 0; i < 1000; i++){
+        enqueue(queue, createTestingStruct(i, 'a'));
+        test = dequeue(queue);
+        TEST_ASSERT_EQUAL_INT_MESSAGE(i, test->num, "dequeue returns wrong item");
+        free(test);
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(QUEUE_INITIAL_CAPACITY, queue->capacity, "steady state queue grew");
+    destroyQueue(queue);
+}
+
+/*
+ * Test: test_iterator
+ * ----------------------------
+ * Test that an iterator walks a wrapped queue front to back and back to front
+ */
+void test_iterator(void){
+    Queue * queue = createQueue(&destroyFunc, &printFunc);
+    QueueIterator iterator = iterBeginQueue(queue);
+    int count = 5;
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, iterValidQueue(&iterator), "iterator valid on empty queue");
+    for(int i = 0; i < QUEUE_INITIAL_CAPACITY; i++){
+        enqueue(queue, createTestingStruct(i, 'a'));
+    }
+    for(int i = 0; i < 5; i++){
+        free(dequeue(queue));
+        enqueue(queue, createTestingStruct(QUEUE_INITIAL_CAPACITY + i, 'a'));
+    }
+    for(iterator = iterBeginQueue(queue); iterValidQueue(&iterator); iterNextQueue(&iterator)){
+        TEST_ASSERT_EQUAL_INT_MESSAGE(count, ((TestStruct*)iterGetQueue(&iterator))->num, "forward iteration out of order");
+        count++;
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(QUEUE_INITIAL_CAPACITY + 5, count, "forward iteration missed items");
+    for(iterator = iterEndQueue(queue); iterValidQueue(&iterator); iterPrevQueue(&iterator)){
+        count--;
+        TEST_ASSERT_EQUAL_INT_MESSAGE(count, ((TestStruct*)iterGetQueue(&iterator))->num, "backward iteration out of order");
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(5, count, "backward iteration missed items");
+    destroyQueue(queue);
+}
+
+/*
+ * Test: test_batch
+ * ----------------------------
+ * Test that enqueueBatch and dequeueBatch keep the queue in order across
+ *      the wrap of the ring buffer and growth, and mix with single items.
+ */
+void test_batch(void){
+    Queue * queue = createQueue(&destroyFunc, &printFunc);
+    void * items[100];
+    int next = 0;
+    int added = 0;
+    char errorString[100];
+    for(int round = 0; round < 20; round++){
+        int count = (round * 37) % 100;
+        for(int i = 0; i < count; i++){
+            items[i] = createTestingStruct(added++, 'a');
+        }
+        TEST_ASSERT_EQUAL_INT_MESSAGE(1, enqueueBatch(queue, items, count), "enqueueBatch failed");
+        enqueue(queue, createTestingStruct(added++, 'b'));
+        int request = (round * 53) % 100;
+        int expected = request < queue->length ? request : queue->length;
+        int removed = dequeueBatch(queue, items, request);
+        TEST_ASSERT_EQUAL_INT_MESSAGE(expected, removed, "dequeueBatch removed the wrong number of items");
+        for(int i = 0; i < removed; i++){
+            sprintf(errorString, "dequeueBatch out of order, expected %d", next);
+            TEST_ASSERT_EQUAL_INT_MESSAGE(next++, ((TestStruct*)items[i])->num, errorString);
+            free(items[i]);
+        }
+        TestStruct * test = dequeue(queue);
+        if(test != NULL){
+            TEST_ASSERT_EQUAL_INT_MESSAGE(next++, test->num, "dequeue after a batch out of order");
+            free(test);
+        }
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(added - next, queue->length, "queue length incorrect after batches");
+    while(queue->length > 0){
+        int removed = dequeueBatch(queue, items, 100);
+        for(int i = 0; i < removed; i++){
+            TEST_ASSERT_EQUAL_INT_MESSAGE(next++, ((TestStruct*)items[i])->num, "final dequeueBatch out of order");
+            free(items[i]);
+        }
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, dequeueBatch(queue, items, 100), "dequeueBatch on an empty queue");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, enqueueBatch(NULL, items, 1), "enqueueBatch on a NULL queue");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, dequeueBatch(NULL, items, 1), "dequeueBatch on a NULL queue");
+    destroyQueue(queue);
+}
+
 int main(void) {
     UNITY_BEGIN();
     
@@ -185,6 +315,10 @@ int main(void) {
     RUN_TEST(test_empty_dequeue);
     RUN_TEST(test_multiple_enqueue_dequeue);
     RUN_TEST(test_large_queue);
+    RUN_TEST(test_wrapped_growth);
+    RUN_TEST(test_steady_state_capacity);
+    RUN_TEST(test_iterator);
+    RUN_TEST(test_batch);
 
     return UNITY_END();
 }
\ No newline at end of file
@@ -0,0 +1,146 @@
+#include <pthread.h>
+#include "unity.h"
+#include "spscQueue.h"
+
+#define ITEMS 200000
+#define BATCH 37
+
+int values[ITEMS];
+
+void noDestroyFunc(void * data){
+}
+
+void printFunc(void * data){
+    printf("%d", *(int*)data);
+}
+
+void setUp(void) {
+    // set stuff up here
+
+}
+
+void tearDown(void) {
+    // clean stuff up here
+}
+
+/*
+ * Test: test_create_spsc_queue
+ * ----------------------------
+ * Ensure createSPSCQueue rounds the capacity to a power of two and that a
+ *      NULL queue is handled gracefully.
+ */
+void test_create_spsc_queue(void){
+    SPSCQueue * queue = createSPSCQueue(100, &noDestroyFunc, &printFunc);
+    void * data;
+    void * items[4];
+    TEST_ASSERT_NOT_NULL_MESSAGE(queue, "createSPSCQueue returned null pointer");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(127, queue->mask, "capacity not rounded to a power of two");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, lengthSPSC(queue), "queue length not zero");
+    TEST_ASSERT_NULL_MESSAGE(createSPSCQueue(0, &noDestroyFunc, &printFunc), "zero capacity queue created");
+    TEST_ASSERT_EQUAL_INT(0, tryEnqueueSPSC(NULL, NULL));
+    TEST_ASSERT_EQUAL_INT(0, tryDequeueSPSC(NULL, &data));
+    TEST_ASSERT_EQUAL_INT(0, enqueueBatchSPSC(NULL, items, 4));
+    TEST_ASSERT_EQUAL_INT(0, dequeueBatchSPSC(queue, items, 4));
+    TEST_ASSERT_EQUAL_INT(0, enqueueSPSC(NULL, NULL));
+    TEST_ASSERT_NULL(dequeueSPSC(NULL));
+    TEST_ASSERT_EQUAL_INT(-1, lengthSPSC(NULL));
+    TEST_ASSERT_EQUAL_INT(0, destroySPSCQueue(NULL));
+    TEST_ASSERT_EQUAL_INT(1, destroySPSCQueue(queue));
+}
+
+/*
+ * Test: test_spsc_full_and_empty
+ * ----------------------------
+ * Test that enqueues fail when full, dequeues fail when empty, and items
+ *      come out in FIFO order across several laps of the ring, one at a
+ *      time and in batches that wrap around the end of the buffer.
+ */
+void test_spsc_full_and_empty(void){
+    SPSCQueue * queue = createSPSCQueue(8, &noDestroyFunc, &printFunc);
+    void * items[8];
+    void * data;
+    int next = 0;
+    int added = 0;
+    for(int lap = 0; lap < 5; lap++){
+        for(int i = 0; i < 3; i++){
+            TEST_ASSERT_EQUAL_INT(1, tryEnqueueSPSC(queue, &values[added++]));
+        }
+        for(int i = 0; i < 8; i++){
+            items[i] = &values[added + i];
+        }
+        int count = enqueueBatchSPSC(queue, items, 8);
+        TEST_ASSERT_EQUAL_INT_MESSAGE(5, count, "batch did not fill the remaining room");
+        added += count;
+        TEST_ASSERT_EQUAL_INT(8, lengthSPSC(queue));
+        TEST_ASSERT_EQUAL_INT_MESSAGE(0, tryEnqueueSPSC(queue, &values[0]), "enqueue did not fail when full");
+        TEST_ASSERT_EQUAL_INT_MESSAGE(0, enqueueBatchSPSC(queue, items, 8), "batch enqueue did not fail when full");
+        TEST_ASSERT_EQUAL_INT(1, tryDequeueSPSC(queue, &data));
+        TEST_ASSERT_EQUAL_PTR_MESSAGE(&values[next++], data, "dequeue out of order");
+        count = dequeueBatchSPSC(queue, items, 8);
+        TEST_ASSERT_EQUAL_INT(7, count);
+        for(int i = 0; i < count; i++){
+            TEST_ASSERT_EQUAL_PTR_MESSAGE(&values[next++], items[i], "batch dequeue out of order");
+        }
+        TEST_ASSERT_EQUAL_INT_MESSAGE(0, tryDequeueSPSC(queue, &data), "empty dequeue did not fail");
+    }
+    destroySPSCQueue(queue);
+}
+
+SPSCQueue * sharedQueue;
+
+void * producer(void * arg){
+    void * items[BATCH];
+    int i = 0;
+    while(i < ITEMS){
+        if(i % 1000 < 500){
+            enqueueSPSC(sharedQueue, &values[i++]);
+            continue;
+        }
+        int count = ITEMS - i < BATCH ? ITEMS - i : BATCH;
+        for(int j = 0; j < count; j++){
+            items[j] = &values[i + j];
+        }
+        i += enqueueBatchSPSC(sharedQueue, items, count);
+    }
+    return NULL;
+}
+
+/*
+ * Test: test_spsc_threads
+ * ----------------------------
+ * Test that a consumer thread receives every item from a producer thread
+ *      exactly once and in order through a small ring.
+ */
+void test_spsc_threads(void){
+    pthread_t thread;
+    void * items[BATCH];
+    int next = 0;
+    int outOfOrder = 0;
+    sharedQueue = createSPSCQueue(64, &noDestroyFunc, &printFunc);
+    pthread_create(&thread, NULL, &producer, NULL);
+    while(next < ITEMS){
+        if(next % 3 == 0){
+            outOfOrder |= dequeueSPSC(sharedQueue) != &values[next++];
+            continue;
+        }
+        int count = dequeueBatchSPSC(sharedQueue, items, BATCH);
+        for(int i = 0; i < count; i++){
+            outOfOrder |= items[i] != &values[next++];
+        }
+    }
+    pthread_join(thread, NULL);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, outOfOrder, "items received out of order");
+    TEST_ASSERT_EQUAL_INT(0, lengthSPSC(sharedQueue));
+    destroySPSCQueue(sharedQueue);
+}
+
+int main(void) {
+
+    UNITY_BEGIN();
+
+    RUN_TEST(test_create_spsc_queue);
+    RUN_TEST(test_spsc_full_and_empty);
+    RUN_TEST(test_spsc_threads);
+
+    return UNITY_END();
+}
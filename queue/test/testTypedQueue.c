@@ -0,0 +1,128 @@
+#include <stdio.h>
+#include "unity.h"
+#include "typedQueue.h"
+
+/*
+ * Struct: Job
+ * ----------------------------
+ * A struct stored by value in a typed queue.
+ */
+typedef struct job{
+    long id;
+    double priority;
+}Job;
+
+DEFINE_QUEUE(IntQueue, int)
+DEFINE_QUEUE(JobQueue, Job)
+
+void setUp(void) {
+    // set stuff up here
+
+}
+
+void tearDown(void) {
+    // clean stuff up here
+}
+
+/*
+ * Test: test_typed_queue_null
+ * ----------------------------
+ * Test that the typed queue functions handle NULL and empty queues.
+ */
+void test_typed_queue_null(void){
+    IntQueue * queue = createIntQueue();
+    int value = 7;
+    int values[4];
+    TEST_ASSERT_NOT_NULL_MESSAGE(queue, "createIntQueue returned NULL");
+    TEST_ASSERT_EQUAL_INT(0, enqueueIntQueue(NULL, 1));
+    TEST_ASSERT_EQUAL_INT(0, dequeueIntQueue(NULL, &value));
+    TEST_ASSERT_EQUAL_INT(0, dequeueIntQueue(queue, &value));
+    TEST_ASSERT_EQUAL_INT_MESSAGE(7, value, "dequeue from an empty queue changed the value");
+    TEST_ASSERT_NULL(peekIntQueue(queue));
+    TEST_ASSERT_EQUAL_INT(0, enqueueBatchIntQueue(queue, NULL, 1));
+    TEST_ASSERT_EQUAL_INT(1, enqueueBatchIntQueue(queue, NULL, 0));
+    TEST_ASSERT_EQUAL_INT(0, dequeueBatchIntQueue(queue, values, 4));
+    TEST_ASSERT_EQUAL_INT(0, destroyIntQueue(NULL));
+    TEST_ASSERT_EQUAL_INT(1, destroyIntQueue(queue));
+}
+
+/*
+ * Test: test_typed_queue_order
+ * ----------------------------
+ * Test that values come out in the order they went in while the ring
+ *      buffer wraps and grows, one at a time and in batches.
+ */
+void test_typed_queue_order(void){
+    IntQueue * queue = createIntQueue();
+    int values[100];
+    int next = 0;
+    int expected = 0;
+    int value;
+    char errorString[100];
+    for(int round = 0; round < 200; round++){
+        int adds = round % 7 + round % 3 * 20;
+        for(int i = 0; i < adds; i++){
+            values[i] = next++;
+        }
+        if(round % 2 == 0){
+            TEST_ASSERT_EQUAL_INT(1, enqueueBatchIntQueue(queue, values, adds));
+        }
+        else{
+            for(int i = 0; i < adds; i++){
+                TEST_ASSERT_EQUAL_INT(1, enqueueIntQueue(queue, values[i]));
+            }
+        }
+        int removes = round % 5 + round % 4 * 10;
+        if(round % 3 == 0){
+            int count = dequeueBatchIntQueue(queue, values, removes);
+            for(int i = 0; i < count; i++){
+                sprintf(errorString, "batch dequeued out of order in round %d", round);
+                TEST_ASSERT_EQUAL_INT_MESSAGE(expected++, values[i], errorString);
+            }
+        }
+        else{
+            for(int i = 0; i < removes && queue->length > 0; i++){
+                TEST_ASSERT_EQUAL_INT_MESSAGE(expected, *peekIntQueue(queue), "peek did not return the front value");
+                dequeueIntQueue(queue, &value);
+                sprintf(errorString, "dequeued out of order in round %d", round);
+                TEST_ASSERT_EQUAL_INT_MESSAGE(expected++, value, errorString);
+            }
+        }
+        TEST_ASSERT_EQUAL_INT_MESSAGE(next - expected, queue->length, "queue length incorrect");
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, queue->capacity & (queue->capacity - 1), "capacity is not a power of two");
+    destroyIntQueue(queue);
+}
+
+/*
+ * Test: test_typed_queue_struct
+ * ----------------------------
+ * Test a queue of structs stored by value.
+ */
+void test_typed_queue_struct(void){
+    JobQueue * queue = createJobQueue();
+    Job job;
+    for(int i = 0; i < 40; i++){
+        job.id = i * 1000000007L;
+        job.priority = i / 2.0;
+        enqueueJobQueue(queue, job);
+    }
+    peekJobQueue(queue)->priority = -1;
+    for(int i = 0; i < 40; i++){
+        dequeueJobQueue(queue, &job);
+        TEST_ASSERT_MESSAGE(job.id == i * 1000000007L, "job id incorrect");
+        TEST_ASSERT_MESSAGE(job.priority == (i == 0 ? -1 : i / 2.0), "job priority incorrect");
+    }
+    destroyJobQueue(queue);
+}
+
+int main(void) {
+
+    UNITY_BEGIN();
+
+    RUN_TEST(test_typed_queue_null);
+    RUN_TEST(test_typed_queue_order);
+    RUN_TEST(test_typed_queue_struct);
+
+    return UNITY_END();
+}
@@ -0,0 +1,129 @@
+#include <pthread.h>
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+#include "stack.h"
+#include "concurrentStack.h"
+
+/*
+ * Benchmark: benchConcurrentStack
+ * ----------------------------
+ * Measures push/pop throughput of the lock free ConcurrentStack against a
+ *      Stack guarded by a mutex for 1 to N threads.  Each thread pushes and
+ *      then pops OPS_PER_THREAD items in bursts of BURST.
+ *
+ * usage: benchConcurrentStack [maxThreads] [opsPerThread]
+ *      maxThreads defaults to the number of online processors.
+ *
+ * output: CSV with one row per stack type and thread count.
+ */
+
+#define BURST 16
+
+typedef struct benchArgs{
+    ConcurrentStack * concurrent;
+    Stack * locked;
+    pthread_mutex_t * lock;
+    pthread_barrier_t * barrier;
+    long ops;
+}BenchArgs;
+
+void noDestroyFunc(void * data){
+}
+
+double now(void){
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+void * concurrentThread(void * arg){
+    BenchArgs * args = arg;
+    pthread_barrier_wait(args->barrier);
+    for(long i = 0; i < args->ops; i += BURST){
+        for(int j = 0; j < BURST; j++){
+            pushConcurrent(args->concurrent, args);
+        }
+        for(int j = 0; j < BURST; j++){
+            popConcurrent(args->concurrent);
+        }
+    }
+    return NULL;
+}
+
+void * lockedThread(void * arg){
+    BenchArgs * args = arg;
+    pthread_barrier_wait(args->barrier);
+    for(long i = 0; i < args->ops; i += BURST){
+        for(int j = 0; j < BURST; j++){
+            pthread_mutex_lock(args->lock);
+            push(args->locked, args);
+            pthread_mutex_unlock(args->lock);
+        }
+        for(int j = 0; j < BURST; j++){
+            pthread_mutex_lock(args->lock);
+            pop(args->locked);
+            pthread_mutex_unlock(args->lock);
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Function: run
+ * ----------------------------
+ * starts threads running body against args and returns the elapsed time
+ *      from the moment all threads are released.
+ */
+double run(int threads, void * (*body)(void *), BenchArgs * args){
+    pthread_t ids[threads];
+    pthread_barrier_t barrier;
+    double start;
+    pthread_barrier_init(&barrier, NULL, threads + 1);
+    args->barrier = &barrier;
+    for(int i = 0; i < threads; i++){
+        pthread_create(&ids[i], NULL, body, args);
+    }
+    start = now();
+    pthread_barrier_wait(&barrier);
+    for(int i = 0; i < threads; i++){
+        pthread_join(ids[i], NULL);
+    }
+    start = now() - start;
+    pthread_barrier_destroy(&barrier);
+    return start;
+}
+
+/*
+ * Function: nextThreads
+ * ----------------------------
+ * returns the thread count to measure after threads: the next power of two,
+ *      or maxThreads itself once doubling would pass it.
+ */
+int nextThreads(int threads, int maxThreads){
+    return threads < maxThreads && threads * 2 > maxThreads ? maxThreads : threads * 2;
+}
+
+int main(int argc, char ** argv){
+    int maxThreads = argc > 1 ? atoi(argv[1]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+    long ops = argc > 2 ? atol(argv[2]) : 1000000;
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+    BenchArgs args;
+    double seconds;
+
+    printf("stack,threads,ops,seconds,ops_per_sec\n");
+    for(int threads = 1; threads <= maxThreads; threads = nextThreads(threads, maxThreads)){
+        args.concurrent = createConcurrentStack(&noDestroyFunc);
+        args.ops = ops;
+        seconds = run(threads, &concurrentThread, &args);
+        printf("treiber,%d,%ld,%.6f,%.0f\n", threads, 2 * ops * threads, seconds, 2 * ops * threads / seconds);
+        destroyConcurrentStack(args.concurrent);
+
+        args.locked = createStack(&noDestroyFunc);
+        args.lock = &lock;
+        seconds = run(threads, &lockedThread, &args);
+        printf("mutex,%d,%ld,%.6f,%.0f\n", threads, 2 * ops * threads, seconds, 2 * ops * threads / seconds);
+        destroyStack(args.locked);
+    }
+    return 0;
+}
@@ -0,0 +1,192 @@
+#include "bench.h"
+#include "stack.h"
+#include "concurrentStack.h"
+#include "typedStack.h"
+#include "intrusiveStack.h"
+
+/*
+ * Benchmark: benchStack
+ * ----------------------------
+ * Measures push and pop of the Stack, one at a time and in batches of
+ *      BATCH, of an IntStack holding the values themselves, of an
+ *      IntrusiveStack of items that carry their own links, and of the
+ *      ConcurrentStack from a single thread, for stack sizes from 10 up to 10^7 in powers of ten.
+ *
+ * usage: benchStack [--csv | --json] [--min size] [--max size]
+ *
+ * output: one row per operation and size, see bench.h.
+ */
+
+#define BATCH 256
+
+DEFINE_STACK(IntStack, int)
+
+typedef struct stackItem{
+    int value;
+    StackLink link;
+}StackItem;
+
+typedef struct stackContext{
+    Stack * stack;
+    IntStack * intStack;
+    IntrusiveStack * intrusive;
+    StackItem * items;
+    ConcurrentStack * concurrent;
+    int * values;
+    int ** pointers;
+    long sum;
+}StackContext;
+
+void noDestroyFunc(void * data){
+}
+
+void pushBody(void * context, long first, long count){
+    StackContext * c = context;
+    for(long i = first; i < first + count; i++){
+        push(c->stack, &c->values[i]);
+    }
+}
+
+void popBody(void * context, long first, long count){
+    StackContext * c = context;
+    for(long i = 0; i < count; i++){
+        pop(c->stack);
+    }
+}
+
+/*
+ * Function: pushPopBody
+ * ----------------------------
+ * one op is a push followed by a pop, so the size stays fixed.
+ */
+void pushPopBody(void * context, long first, long count){
+    StackContext * c = context;
+    for(long i = first; i < first + count; i++){
+        push(c->stack, &c->values[i]);
+        pop(c->stack);
+    }
+}
+
+/*
+ * Function: pushManyBody
+ * ----------------------------
+ * pushes the values in batches of BATCH.  One op is one item.
+ */
+void pushManyBody(void * context, long first, long count){
+    StackContext * c = context;
+    for(long i = first; i < first + count; i += BATCH){
+        int batch = first + count - i < BATCH ? first + count - i : BATCH;
+        pushMany(c->stack, (void **)&c->pointers[i], batch);
+    }
+}
+
+void popManyBody(void * context, long first, long count){
+    StackContext * c = context;
+    void * items[BATCH];
+    for(long i = 0; i < count; i += BATCH){
+        popMany(c->stack, items, count - i < BATCH ? count - i : BATCH);
+    }
+}
+
+void intPushBody(void * context, long first, long count){
+    StackContext * c = context;
+    for(long i = first; i < first + count; i++){
+        pushIntStack(c->intStack, c->values[i]);
+    }
+}
+
+/*
+ * Function: intPopBody
+ * ----------------------------
+ * sums the popped values so the compiler cannot drop the loads.
+ */
+void intPopBody(void * context, long first, long count){
+    StackContext * c = context;
+    int value;
+    for(long i = 0; i < count; i++){
+        if(popIntStack(c->intStack, &value)){
+            c->sum += value;
+        }
+    }
+}
+
+void pushIntrusiveBody(void * context, long first, long count){
+    StackContext * c = context;
+    for(long i = first; i < first + count; i++){
+        pushIntrusive(c->intrusive, &c->items[i]);
+    }
+}
+
+void popIntrusiveBody(void * context, long first, long count){
+    StackContext * c = context;
+    for(long i = 0; i < count; i++){
+        popIntrusive(c->intrusive);
+    }
+}
+
+void pushConcurrentBody(void * context, long first, long count){
+    StackContext * c = context;
+    for(long i = first; i < first + count; i++){
+        pushConcurrent(c->concurrent, &c->values[i]);
+    }
+}
+
+void popConcurrentBody(void * context, long first, long count){
+    StackContext * c = context;
+    for(long i = 0; i < count; i++){
+        popConcurrent(c->concurrent);
+    }
+}
+
+int main(int argc, char ** argv){
+    Bench bench;
+    StackContext context;
+    if(!benchInit(&bench, argc, argv)){
+        return 1;
+    }
+    context.values = malloc(sizeof(int) * bench.maxSize);
+    context.pointers = malloc(sizeof(int *) * bench.maxSize);
+    context.items = malloc(sizeof(StackItem) * bench.maxSize);
+    context.sum = 0;
+    if(context.values == NULL || context.pointers == NULL || context.items == NULL){
+        return 1;
+    }
+    for(long i = 0; i < bench.maxSize; i++){
+        context.values[i] = (int)i;
+        context.pointers[i] = &context.values[i];
+        context.items[i].value = (int)i;
+    }
+
+    for(long size = bench.minSize; size <= bench.maxSize; size *= 10){
+        context.stack = createStack(&noDestroyFunc);
+        benchRun(&bench, "stack", "push", size, size, size / 10, NULL, &pushBody, &context);
+        benchRun(&bench, "stack", "push_pop", size, size, size / 10, NULL, &pushPopBody, &context);
+        benchRun(&bench, "stack", "pop", size, size, size / 10, NULL, &popBody, &context);
+        destroyStack(context.stack);
+
+        context.stack = createStack(&noDestroyFunc);
+        benchRun(&bench, "stack", "pushMany", size, size, size / (BATCH * 4), NULL, &pushManyBody, &context);
+        benchRun(&bench, "stack", "popMany", size, size, size / (BATCH * 4), NULL, &popManyBody, &context);
+        destroyStack(context.stack);
+
+        context.intStack = createIntStack();
+        benchRun(&bench, "intStack", "push", size, size, size / 10, NULL, &intPushBody, &context);
+        benchRun(&bench, "intStack", "pop", size, size, size / 10, NULL, &intPopBody, &context);
+        destroyIntStack(context.intStack);
+
+        context.intrusive = createIntrusiveStack(offsetof(StackItem, link), NULL);
+        benchRun(&bench, "intrusiveStack", "pushIntrusive", size, size, size / 10, NULL, &pushIntrusiveBody, &context);
+        benchRun(&bench, "intrusiveStack", "popIntrusive", size, size, size / 10, NULL, &popIntrusiveBody, &context);
+        destroyIntrusiveStack(context.intrusive);
+
+        context.concurrent = createConcurrentStack(&noDestroyFunc);
+        benchRun(&bench, "concurrentStack", "pushConcurrent", size, size, size / 10, NULL, &pushConcurrentBody, &context);
+        benchRun(&bench, "concurrentStack", "popConcurrent", size, size, size / 10, NULL, &popConcurrentBody, &context);
+        destroyConcurrentStack(context.concurrent);
+    }
+    benchFinish(&bench);
+    free(context.values);
+    free(context.pointers);
+    free(context.items);
+    return 0;
+}
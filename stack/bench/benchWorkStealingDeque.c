@@ -0,0 +1,186 @@
+#include <pthread.h>
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+#include "stack.h"
+#include "workStealingDeque.h"
+
+/*
+ * Benchmark: benchWorkStealingDeque
+ * ----------------------------
+ * Measures the throughput of a task scheduler's queue: one owner thread
+ *      pushes items in bursts of BURST and pops half of each burst back,
+ *      while the other threads steal.  The lock free WorkStealingDeque is
+ *      compared against a Stack guarded by a mutex, which the owner and the
+ *      thieves all push and pop under the lock.
+ *
+ * usage: benchWorkStealingDeque [maxThreads] [items]
+ *      maxThreads defaults to the number of online processors.
+ *
+ * output: CSV with one row per deque type and thread count.
+ */
+
+#define BURST 32
+
+typedef struct benchArgs{
+    WorkStealingDeque * deque;
+    Stack * locked;
+    pthread_mutex_t * lock;
+    pthread_barrier_t * barrier;
+    atomic_int done;
+    atomic_long taken;
+    long items;
+}BenchArgs;
+
+void noDestroyFunc(void * data){
+}
+
+double now(void){
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+void * dequeOwner(void * arg){
+    BenchArgs * args = arg;
+    long taken = 0;
+    pthread_barrier_wait(args->barrier);
+    for(long i = 0; i < args->items; i += BURST){
+        for(long j = i; j < i + BURST && j < args->items; j++){
+            pushWorkStealing(args->deque, args);
+        }
+        for(int j = 0; j < BURST / 2 && popWorkStealing(args->deque) != NULL; j++){
+            taken++;
+        }
+    }
+    while(popWorkStealing(args->deque) != NULL){
+        taken++;
+    }
+    atomic_store(&args->done, 1);
+    atomic_fetch_add(&args->taken, taken);
+    return NULL;
+}
+
+void * dequeThief(void * arg){
+    BenchArgs * args = arg;
+    long taken = 0;
+    void * data;
+    pthread_barrier_wait(args->barrier);
+    while(!atomic_load_explicit(&args->done, memory_order_relaxed) || sizeWorkStealing(args->deque) > 0){
+        taken += stealWorkStealing(args->deque, &data) == 1;
+    }
+    atomic_fetch_add(&args->taken, taken);
+    return NULL;
+}
+
+void * lockedOwner(void * arg){
+    BenchArgs * args = arg;
+    long taken = 0;
+    void * data;
+    pthread_barrier_wait(args->barrier);
+    for(long i = 0; i < args->items; i += BURST){
+        for(long j = i; j < i + BURST && j < args->items; j++){
+            pthread_mutex_lock(args->lock);
+            push(args->locked, args);
+            pthread_mutex_unlock(args->lock);
+        }
+        for(int j = 0; j < BURST / 2; j++){
+            pthread_mutex_lock(args->lock);
+            data = pop(args->locked);
+            pthread_mutex_unlock(args->lock);
+            if(data == NULL){
+                break;
+            }
+            taken++;
+        }
+    }
+    do{
+        pthread_mutex_lock(args->lock);
+        data = pop(args->locked);
+        pthread_mutex_unlock(args->lock);
+        taken += data != NULL;
+    }while(data != NULL);
+    atomic_store(&args->done, 1);
+    atomic_fetch_add(&args->taken, taken);
+    return NULL;
+}
+
+void * lockedThief(void * arg){
+    BenchArgs * args = arg;
+    long taken = 0;
+    void * data;
+    pthread_barrier_wait(args->barrier);
+    do{
+        pthread_mutex_lock(args->lock);
+        data = pop(args->locked);
+        pthread_mutex_unlock(args->lock);
+        taken += data != NULL;
+    }while(data != NULL || !atomic_load_explicit(&args->done, memory_order_relaxed));
+    atomic_fetch_add(&args->taken, taken);
+    return NULL;
+}
+
+/*
+ * Function: run
+ * ----------------------------
+ * starts an owner thread and threads - 1 thieves against args and returns
+ *      the elapsed time from the moment all threads are released.
+ */
+double run(int threads, void * (*owner)(void *), void * (*thief)(void *), BenchArgs * args){
+    pthread_t ids[threads];
+    pthread_barrier_t barrier;
+    double start;
+    pthread_barrier_init(&barrier, NULL, threads + 1);
+    args->barrier = &barrier;
+    atomic_store(&args->done, 0);
+    atomic_store(&args->taken, 0);
+    pthread_create(&ids[0], NULL, owner, args);
+    for(int i = 1; i < threads; i++){
+        pthread_create(&ids[i], NULL, thief, args);
+    }
+    start = now();
+    pthread_barrier_wait(&barrier);
+    for(int i = 0; i < threads; i++){
+        pthread_join(ids[i], NULL);
+    }
+    start = now() - start;
+    pthread_barrier_destroy(&barrier);
+    if(atomic_load(&args->taken) != args->items){
+        fprintf(stderr, "%d threads: %ld of %ld items taken\n", threads, atomic_load(&args->taken), args->items);
+    }
+    return start;
+}
+
+/*
+ * Function: nextThreads
+ * ----------------------------
+ * returns the thread count to measure after threads: the next power of two,
+ *      or maxThreads itself once doubling would pass it.
+ */
+int nextThreads(int threads, int maxThreads){
+    return threads < maxThreads && threads * 2 > maxThreads ? maxThreads : threads * 2;
+}
+
+int main(int argc, char ** argv){
+    int maxThreads = argc > 1 ? atoi(argv[1]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+    long items = argc > 2 ? atol(argv[2]) : 10000000;
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+    BenchArgs args;
+    double seconds;
+
+    args.items = items;
+    printf("deque,threads,items,seconds,items_per_sec\n");
+    for(int threads = 1; threads <= maxThreads; threads = nextThreads(threads, maxThreads)){
+        args.deque = createWorkStealingDeque(&noDestroyFunc);
+        seconds = run(threads, &dequeOwner, &dequeThief, &args);
+        printf("chaseLev,%d,%ld,%.6f,%.0f\n", threads, items, seconds, items / seconds);
+        destroyWorkStealingDeque(args.deque);
+
+        args.locked = createStack(&noDestroyFunc);
+        args.lock = &lock;
+        seconds = run(threads, &lockedOwner, &lockedThief, &args);
+        printf("mutex,%d,%ld,%.6f,%.0f\n", threads, items, seconds, items / seconds);
+        destroyStack(args.locked);
+    }
+    return 0;
+}
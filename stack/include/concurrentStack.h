@@ -0,0 +1,108 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#ifndef CONCURRENT_STACK_H
+#define CONCURRENT_STACK_H
+
+#define CS_CHUNK_SIZE 4096
+#define CS_MAX_CHUNKS 4096
+
+/*
+ * Struct: ConcurrentStackNode
+ * ----------------------------
+ * A node of the concurrent stack.  Nodes are referred to by their index in
+ *      the stack's node arena rather than by address.
+ *
+ * next: the index plus one of the next node in the stack.  0 if none.
+ * data: the data stored in the Node
+ *
+ */
+typedef struct concurrentStackNode{
+    atomic_uint_least32_t next;
+    void * data;
+}ConcurrentStackNode;
+
+/*
+ * Struct: ConcurrentStack
+ * ----------------------------
+ * Represents a lock free LIFO stack (a Treiber stack) that may be pushed and
+ *      popped by any number of threads at once.
+ *
+ * top: the top of the stack.  The low 32 bits hold the index plus one of the
+ *      top node and the high 32 bits hold a tag that is incremented by every
+ *      change, so a compare and swap fails if the top was popped and pushed
+ *      back in between (the ABA problem).
+ * freeNodes: a tagged list of popped nodes waiting to be reused, in the
+ *      same format as top.
+ * nextNode: the index of the next node that has never been used.
+ * chunks: the node arena.  Nodes are never freed while the stack exists,
+ *      so a thread that loses a race may still safely read a node.
+ * destroyData: A function pointer that is used to free the data
+ *      stored in the stack.
+ *
+ */
+typedef struct concurrentStack{
+    _Atomic uint64_t top;
+    _Atomic uint64_t freeNodes;
+    atomic_uint_least32_t nextNode;
+    ConcurrentStackNode * _Atomic chunks[CS_MAX_CHUNKS];
+    void (*destroyData)(void * data);
+}ConcurrentStack;
+
+/*
+ * Function: createConcurrentStack
+ * ----------------------------
+ * Creates a pointer to a concurrent stack data structure
+ *
+ * destroyFunc: a function pointer that destroys the data type intended
+ *      to be stored in the stack
+ *
+ * return: a pointer to the created stack.  NULL if failed.
+ */
+ConcurrentStack * createConcurrentStack(void (*destroyFunc)(void * data));
+
+/*
+ * Function: pushConcurrent
+ * ----------------------------
+ * Adds new data to the top of the stack.  Safe to call from any number of
+ *      threads.
+ *
+ * stack: the stack to perform the push operation on.
+ * data: the data to added to the top of the stack.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int pushConcurrent(ConcurrentStack * stack, void * data);
+
+/*
+ * Function: popConcurrent
+ * ----------------------------
+ * removes the item on the top of the stack and returns the data.  Safe to
+ *      call from any number of threads.
+ *
+ * stack: the stack to perform the pop operation on.
+ *
+ * return: a void pointer of the data stored in the top of the
+ *     stack.  NULL if the stack is empty.
+ */
+void * popConcurrent(ConcurrentStack * stack);
+
+/*
+ * Function: destroyConcurrentStack
+ * ----------------------------
+ * Frees the stack and all data stored in the stack using the destroyData
+ *      function pointer
+ *
+ * stack: the stack to perform the destroy operation on.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ *
+ * note: No other thread may be using the stack when it is destroyed.
+ */
+int destroyConcurrentStack(ConcurrentStack * stack);
+
+#endif
@@ -0,0 +1,93 @@
+#include <stdlib.h>
+#include <stddef.h>
+#ifndef INTRUSIVE_STACK_H
+#define INTRUSIVE_STACK_H
+
+/*
+ * Struct: StackLink
+ * ----------------------------
+ * The link of an item in an intrusive stack.  The caller embeds one in the
+ *      struct of each item, so pushing an item allocates nothing.
+ *
+ * next: the link of the item below this one.  NULL at the bottom.
+ */
+typedef struct stackLink{
+    struct stackLink * next;
+}StackLink;
+
+/*
+ * Struct: IntrusiveStack
+ * ----------------------------
+ * Represents a LIFO stack of items that carry their own links.  The items
+ *      are passed in and returned as pointers to the items themselves, like
+ *      the data of a Stack.
+ *
+ * top: the link of the item most recently pushed.
+ * offset: the offset of the StackLink within each item, from offsetof.
+ * destroyData: A function pointer that is used to free the items still in
+ *      the stack when it is destroyed.  NULL to leave them to the caller.
+ * size: The number of items in the stack.
+ *
+ */
+typedef struct intrusiveStack{
+    StackLink * top;
+    size_t offset;
+    void (*destroyData)(void * data);
+    int size;
+}IntrusiveStack;
+
+/*
+ * Function: createIntrusiveStack
+ * ----------------------------
+ * Creates a pointer to an intrusive stack data structure
+ *
+ * offset: the offset of the StackLink within the items, e.g.
+ *      offsetof(Frame, link).  An item may be in several stacks at once
+ *      through different links.
+ * destroyFunc: a function pointer that destroys the items left in the
+ *      stack when it is destroyed.  May be NULL.
+ *
+ * return: a pointer to the created stack.  NULL if failed.
+ */
+IntrusiveStack * createIntrusiveStack(size_t offset, void (*destroyFunc)(void * data));
+
+/*
+ * Function: pushIntrusive
+ * ----------------------------
+ * Adds an item to the top of the stack
+ *
+ * stack: the stack to perform the push operation on.
+ * data: the item to add.  Its link must not be in use by another stack.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int pushIntrusive(IntrusiveStack * stack, void * data);
+
+/*
+ * Function: popIntrusive
+ * ----------------------------
+ * removes the top item of the stack and returns it.  Its link may be used
+ *      to add it to another stack straight away.
+ *
+ * stack: the stack to perform the pop operation on.
+ *
+ * return: the item on top of the stack.  NULL if empty.
+ */
+void * popIntrusive(IntrusiveStack * stack);
+
+/*
+ * Function: destroyIntrusiveStack
+ * ----------------------------
+ * Frees the stack, and the items left in it if it has a destroyData.
+ *
+ * stack: the stack to perform the destroy operation on.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int destroyIntrusiveStack(IntrusiveStack * stack);
+
+#endif
@@ -1,39 +1,52 @@
 #include <stdlib.h>
 #ifndef STACK_H
 #define STACK_H
-/*
- * Struct: Node
- * ----------------------------
- * A data structure that holds the data of the stack.  A new Node is
- *      created for each item added to the stack
- *      
- * next: the next item in the stack
- * data: the data stored in the Node
- * 
- */
-typedef struct stackNode{
-    struct stackNode * next;
-    void * data;
-}StackNode;
+#define STACK_INITIAL_CAPACITY 16
 
 /*
  * Struct: Stack
  * ----------------------------
- * Represents a LIFO stack data structure.
+ * Represents a LIFO stack data structure.  The data is stored in a
+ *      contiguous array that doubles in size when full.
  *      
- * head: The top of the stack.
+ * items: The array holding the data.  The top of the stack is items[size - 1].
+ * capacity: The number of items the array can hold.
+ * reserved: The capacity requested with reserveStack.  The stack never
+ *      shrinks below this.
+ * shrink: 1 if the array is halved once the stack is a quarter full.
+ *      0 if the array only grows.
  * destroyData: A function pointer that is used to free the data
  *      stored in the Stack.
  * 
  */
 typedef struct stack{
-    StackNode * top;
+    void ** items;
+    int capacity;
+    int reserved;
+    int shrink;
     void (*destroyData)(void * data);
     int size;
 
 }Stack;
 
 
+/*
+ * Struct: StackIterator
+ * ----------------------------
+ * A position in a stack used to walk the stack from top to bottom or
+ *      bottom to top without popping items.
+ * 
+ * stack: the stack being iterated over.
+ * position: the index of the item in the item array.
+ * 
+ * note: push and pop do not move the items below the top, so an iterator
+ *      on an item that has not been popped stays on that item.
+ */
+typedef struct stackIterator{
+    Stack * stack;
+    int position;
+}StackIterator;
+
 /*
  * Function: createStack
  * ----------------------------
@@ -42,10 +55,41 @@ typedef struct stack{
  * destroyFunc: a function pointer that destroys the data type intended
  *      to be stored in the stack
  * 
- * return: a pointer to the created stack
+ * return: a pointer to the created stack.  NULL if failed.
  */
 Stack * createStack(void (*destroyFunc)(void * data));
 
+/*
+ * Function: reserveStack
+ * ----------------------------
+ * Grows the stack so it can hold at least capacity items without
+ *      reallocating.
+ * 
+ * stack: the stack to perform the reserve operation on.
+ * capacity: the number of items the stack must be able to hold.
+ * 
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int reserveStack(Stack * stack, int capacity);
+
+/*
+ * Function: setStackShrink
+ * ----------------------------
+ * Enables or disables releasing memory as the stack empties.  When enabled
+ *      the array is halved once the stack falls to a quarter of its capacity,
+ *      so alternating push and pop at a boundary does not reallocate.
+ * 
+ * stack: the stack to configure.
+ * shrink: 1 to enable shrinking. 0 to disable it.
+ * 
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int setStackShrink(Stack * stack, int shrink);
+
 /*
  * Function: push
  * ----------------------------
@@ -72,6 +116,37 @@ int push(Stack * stack, void * data);
  */
 void * pop(Stack * stack);
 
+/*
+ * Function: pushMany
+ * ----------------------------
+ * Adds count items to the top of the stack in order, so the last item ends
+ *      up on top.  The array is grown once for the whole batch and the items
+ *      are copied in as one block.
+ * 
+ * stack: the stack to perform the push operation on.
+ * items: the data to be added, bottom item first.
+ * count: the number of items.
+ * 
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure, no items were added
+ * 1: success
+ */
+int pushMany(Stack * stack, void ** items, int count);
+
+/*
+ * Function: popMany
+ * ----------------------------
+ * removes up to count items from the top of the stack into an array.
+ * 
+ * stack: the stack to perform the pop operation on.
+ * items: filled with the removed data, top of the stack first, in the
+ *      order pop would have returned them.
+ * count: the size of items.
+ * 
+ * return: the number of items removed.  0 if the stack is empty or NULL.
+ */
+int popMany(Stack * stack, void ** items, int count);
+
 /*
  * Function: destroyStack
  * ----------------------------
@@ -90,4 +165,74 @@ void * pop(Stack * stack);
  */
 int destroyStack(Stack * stack);
 
+/*
+ * Function: iterBeginStack
+ * ----------------------------
+ * Creates an iterator positioned at the top of the stack, the next item
+ *      to be popped.
+ * 
+ * stack: the stack to iterate over.
+ * 
+ * return: an iterator on the top item.  The iterator is not valid if the
+ *      stack is empty or NULL.
+ */
+StackIterator iterBeginStack(Stack * stack);
+
+/*
+ * Function: iterEndStack
+ * ----------------------------
+ * Creates an iterator positioned at the bottom of the stack, for walking
+ *      the stack from the bottom up.
+ * 
+ * stack: the stack to iterate over.
+ * 
+ * return: an iterator on the bottom item.  The iterator is not valid if the
+ *      stack is empty or NULL.
+ */
+StackIterator iterEndStack(Stack * stack);
+
+/*
+ * Function: iterValidStack
+ * ----------------------------
+ * Checks whether the iterator is positioned on an item.
+ * 
+ * iterator: the iterator to check.
+ * 
+ * return: 1 if the iterator is on an item. 0 if it has run off either end.
+ */
+int iterValidStack(StackIterator * iterator);
+
+/*
+ * Function: iterGetStack
+ * ----------------------------
+ * retrieve the item the iterator is positioned on.
+ * 
+ * iterator: the iterator to read.
+ * 
+ * return: a pointer of the data at the iterator.  NULL if not valid.
+ */
+void * iterGetStack(StackIterator * iterator);
+
+/*
+ * Function: iterNextStack
+ * ----------------------------
+ * moves the iterator one item towards the bottom of the stack.
+ * 
+ * iterator: the iterator to move.
+ * 
+ * return: 1 if the iterator is on an item after moving. 0 otherwise.
+ */
+int iterNextStack(StackIterator * iterator);
+
+/*
+ * Function: iterPrevStack
+ * ----------------------------
+ * moves the iterator one item towards the top of the stack.
+ * 
+ * iterator: the iterator to move.
+ * 
+ * return: 1 if the iterator is on an item after moving. 0 otherwise.
+ */
+int iterPrevStack(StackIterator * iterator);
+
 #endif
@@ -0,0 +1,151 @@
+#include <stdlib.h>
+#include <string.h>
+#ifndef TYPED_STACK_H
+#define TYPED_STACK_H
+#define TYPED_STACK_INITIAL_CAPACITY 16
+
+/*
+ * Macro: DEFINE_STACK
+ * ----------------------------
+ * Defines a LIFO stack that stores values of type T in a contiguous array
+ *      that doubles when full, and the functions to use it.  Values are
+ *      copied into the array, so pushing a small scalar allocates nothing
+ *      once the array has grown to the working size of the stack and needs
+ *      no destroy function.
+ *
+ * name: the name of the stack type.  Every function is named after it,
+ *      e.g. DEFINE_STACK(IntStack, int) defines IntStack, createIntStack,
+ *      pushIntStack and so on.
+ * T: the type of the values.  Values are copied in and out by assignment.
+ *
+ * The functions mirror those of Stack:
+ *
+ *      name * create##name(void)
+ *      int reserve##name(name * stack, int capacity)
+ *      int push##name(name * stack, T value)
+ *      int pop##name(name * stack, T * value)
+ *      T * peek##name(name * stack)
+ *      int pushMany##name(name * stack, T * values, int count)
+ *      int popMany##name(name * stack, T * values, int count)
+ *      int destroy##name(name * stack)
+ *
+ * pop copies the top value into value unless it is NULL and returns 1, or
+ *      0 if the stack is empty or NULL.  peek returns a pointer to the top
+ *      value inside the array, valid until the stack next changes, or NULL
+ *      if the stack is empty.  The rest return what their Stack
+ *      counterparts do.
+ *
+ * note: the stack does not free anything the values point to.  There is
+ *      no counterpart to setStackShrink: the array only grows.  Every
+ *      function is static inline.
+ */
+#define DEFINE_STACK(name, T) \
+typedef struct name{ \
+    T * items; \
+    int capacity; \
+    int size; \
+}name; \
+ \
+static inline name * create##name(void){ \
+    name * stack = malloc(sizeof(name)); \
+    if(stack == NULL){ \
+        return NULL; \
+    } \
+    stack->items = malloc(sizeof(T) * TYPED_STACK_INITIAL_CAPACITY); \
+    if(stack->items == NULL){ \
+        free(stack); \
+        return NULL; \
+    } \
+    stack->capacity = TYPED_STACK_INITIAL_CAPACITY; \
+    stack->size = 0; \
+    return stack; \
+} \
+ \
+static inline int reserve##name(name * stack, int capacity){ \
+    if(stack == NULL || capacity < 0){ \
+        return 0; \
+    } \
+    if(capacity > stack->capacity){ \
+        T * items = realloc(stack->items, sizeof(T) * capacity); \
+        if(items == NULL){ \
+            return 0; \
+        } \
+        stack->items = items; \
+        stack->capacity = capacity; \
+    } \
+    return 1; \
+} \
+ \
+static inline int push##name(name * stack, T value){ \
+    if(stack == NULL){ \
+        return 0; \
+    } \
+    if(stack->size == stack->capacity && !reserve##name(stack, stack->capacity * 2)){ \
+        return 0; \
+    } \
+    stack->items[stack->size++] = value; \
+    return 1; \
+} \
+ \
+static inline int pop##name(name * stack, T * value){ \
+    if(stack == NULL || stack->size == 0){ \
+        return 0; \
+    } \
+    stack->size--; \
+    if(value != NULL){ \
+        *value = stack->items[stack->size]; \
+    } \
+    return 1; \
+} \
+ \
+static inline T * peek##name(name * stack){ \
+    if(stack == NULL || stack->size == 0){ \
+        return NULL; \
+    } \
+    return &stack->items[stack->size - 1]; \
+} \
+ \
+static inline int pushMany##name(name * stack, T * values, int count){ \
+    if(stack == NULL || count < 0 || (values == NULL && count > 0)){ \
+        return 0; \
+    } \
+    if(stack->size + count > stack->capacity){ \
+        int capacity = stack->capacity; \
+        while(capacity < stack->size + count){ \
+            capacity *= 2; \
+        } \
+        if(!reserve##name(stack, capacity)){ \
+            return 0; \
+        } \
+    } \
+    if(count > 0){ \
+        memcpy(stack->items + stack->size, values, sizeof(T) * count); \
+    } \
+    stack->size += count; \
+    return 1; \
+} \
+ \
+static inline int popMany##name(name * stack, T * values, int count){ \
+    if(stack == NULL || count <= 0 || values == NULL){ \
+        return 0; \
+    } \
+    if(count > stack->size){ \
+        count = stack->size; \
+    } \
+    for(int i = 0; i < count; i++){ \
+        values[i] = stack->items[stack->size - 1 - i]; \
+    } \
+    stack->size -= count; \
+    return count; \
+} \
+ \
+static inline int destroy##name(name * stack){ \
+    if(stack == NULL){ \
+        return 0; \
+    } \
+    free(stack->items); \
+    free(stack); \
+    return 1; \
+}
+
+#endif
@@ -0,0 +1,140 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#ifndef WORK_STEALING_DEQUE_H
+#define WORK_STEALING_DEQUE_H
+#define WS_INITIAL_CAPACITY 64
+#define WS_CACHE_LINE 64
+
+/*
+ * Struct: WorkStealingArray
+ * ----------------------------
+ * A circular array of the items in a work stealing deque.  The item at
+ *      position i is stored in items[i & (capacity - 1)].
+ *
+ * capacity: the number of items the array can hold.  A power of two.
+ * previous: the smaller array this one replaced.  A thief may still be
+ *      reading it, so it is kept until the deque is destroyed.
+ * items: the data.
+ *
+ */
+typedef struct workStealingArray{
+    int64_t capacity;
+    struct workStealingArray * previous;
+    void * _Atomic items[];
+}WorkStealingArray;
+
+/*
+ * Struct: WorkStealingDeque
+ * ----------------------------
+ * Represents a lock free work stealing deque (a Chase-Lev deque).  One
+ *      owner thread pushes and pops items LIFO at the bottom, and any number
+ *      of other threads steal items FIFO from the top.  The owner only
+ *      competes with thieves for the last item.
+ *
+ * top: the position of the oldest item.  Advanced by a compare and swap
+ *      when an item is stolen, or when the owner pops the last item.
+ * bottom: one past the position of the newest item.  Written only by the
+ *      owner.
+ * array: the circular array of items.  Replaced by one twice the size by
+ *      the owner when it is full.
+ * destroyData: A function pointer that is used to free the data
+ *      stored in the deque.
+ *
+ * note: top and bottom are kept on separate cache lines, so thieves
+ *      stealing do not slow down the owner's pushes and pops.
+ */
+typedef struct workStealingDeque{
+    _Alignas(WS_CACHE_LINE) _Atomic int64_t top;
+    _Alignas(WS_CACHE_LINE) _Atomic int64_t bottom;
+    WorkStealingArray * _Atomic array;
+    void (*destroyData)(void * data);
+}WorkStealingDeque;
+
+/*
+ * Function: createWorkStealingDeque
+ * ----------------------------
+ * Creates a pointer to a work stealing deque data structure
+ *
+ * destroyFunc: a function pointer that destroys the data type intended
+ *      to be stored in the deque
+ *
+ * return: a pointer to the created deque.  NULL if failed.
+ */
+WorkStealingDeque * createWorkStealingDeque(void (*destroyFunc)(void * data));
+
+/*
+ * Function: pushWorkStealing
+ * ----------------------------
+ * Adds new data to the bottom of the deque, growing the array if it is
+ *      full.  Only the owner thread may call it.
+ *
+ * deque: the deque to perform the push operation on.
+ * data: the data to added to the bottom of the deque.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int pushWorkStealing(WorkStealingDeque * deque, void * data);
+
+/*
+ * Function: popWorkStealing
+ * ----------------------------
+ * removes the item on the bottom of the deque, the most recently pushed,
+ *      and returns the data.  Only the owner thread may call it.
+ *
+ * deque: the deque to perform the pop operation on.
+ *
+ * return: a void pointer of the data stored in the bottom of the
+ *     deque.  NULL if the deque is empty or a thief took the last item.
+ */
+void * popWorkStealing(WorkStealingDeque * deque);
+
+/*
+ * Function: stealWorkStealing
+ * ----------------------------
+ * removes the item on the top of the deque, the least recently pushed.
+ *      Safe to call from any number of threads other than the owner.
+ *
+ * deque: the deque to perform the steal operation on.
+ * data: set to the removed data on success.
+ *
+ * return: an integer indicating the result of the operation
+ * -1: another thread took the top item first.  The deque may not be empty,
+ *      so the steal may be retried.
+ * 0: failure, the deque is empty or NULL
+ * 1: success
+ */
+int stealWorkStealing(WorkStealingDeque * deque, void ** data);
+
+/*
+ * Function: sizeWorkStealing
+ * ----------------------------
+ * returns the number of items in the deque.  The value is a snapshot and
+ *      may be stale by the time it is used if other threads are active.
+ *
+ * deque: the deque to measure.
+ *
+ * return: the number of items in the deque.  -1 if the deque is NULL.
+ */
+int sizeWorkStealing(WorkStealingDeque * deque);
+
+/*
+ * Function: destroyWorkStealingDeque
+ * ----------------------------
+ * Frees the deque and all data stored in the deque using the destroyData
+ *      function pointer
+ *
+ * deque: the deque to perform the destroy operation on.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ *
+ * note: No other thread may be using the deque when it is destroyed.  Data
+ *      that was popped or stolen belongs to the caller and is not destroyed.
+ */
+int destroyWorkStealingDeque(WorkStealingDeque * deque);
+
+#endif
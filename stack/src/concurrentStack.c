@@ -0,0 +1,211 @@
+#include "concurrentStack.h"
+
+/**internal functions**/
+
+#define CS_INDEX(head) ((uint32_t)(head))
+#define CS_TAG(head) ((uint32_t)((head) >> 32))
+#define CS_HEAD(tag, index) (((uint64_t)(tag) << 32) | (index))
+
+/*
+ * Function: nodeAt
+ * ----------------------------
+ * returns the node stored at index - 1 in the node arena.
+ */
+ConcurrentStackNode * nodeAt(ConcurrentStack * stack, uint32_t index){
+    index--;
+    ConcurrentStackNode * chunk = atomic_load_explicit(&stack->chunks[index / CS_CHUNK_SIZE], memory_order_acquire);
+    return &chunk[index % CS_CHUNK_SIZE];
+}
+
+/*
+ * Function: pushNode
+ * ----------------------------
+ * links a node onto a tagged list.
+ *
+ * list: the tagged list, either the top of the stack or its free list.
+ * index: the index plus one of the node to link.
+ */
+void pushNode(ConcurrentStack * stack, _Atomic uint64_t * list, uint32_t index){
+    ConcurrentStackNode * node = nodeAt(stack, index);
+    uint64_t head = atomic_load_explicit(list, memory_order_relaxed);
+    uint64_t newHead;
+    do{
+        atomic_store_explicit(&node->next, CS_INDEX(head), memory_order_relaxed);
+        newHead = CS_HEAD(CS_TAG(head) + 1, index);
+    }while(!atomic_compare_exchange_weak_explicit(list, &head, newHead, memory_order_release, memory_order_relaxed));
+}
+
+/*
+ * Function: popNode
+ * ----------------------------
+ * unlinks the first node of a tagged list.
+ *
+ * list: the tagged list, either the top of the stack or its free list.
+ *
+ * return: the index plus one of the unlinked node.  0 if the list is empty.
+ *
+ * implementation details: the next index read from a node that another
+ *      thread popped and reused in the meantime may be stale, but the tag of
+ *      the head will have changed so the compare and swap fails and retries.
+ */
+uint32_t popNode(ConcurrentStack * stack, _Atomic uint64_t * list){
+    uint64_t head = atomic_load_explicit(list, memory_order_acquire);
+    uint64_t newHead;
+    do{
+        if(CS_INDEX(head) == 0){
+            return 0;
+        }
+        uint32_t next = atomic_load_explicit(&nodeAt(stack, CS_INDEX(head))->next, memory_order_relaxed);
+        newHead = CS_HEAD(CS_TAG(head) + 1, next);
+    }while(!atomic_compare_exchange_weak_explicit(list, &head, newHead, memory_order_acquire, memory_order_acquire));
+    return CS_INDEX(head);
+}
+
+/*
+ * Function: allocateNode
+ * ----------------------------
+ * takes a node from the free list, or the next never used node of the
+ *      arena if the free list is empty.
+ *
+ * return: the index plus one of the node.  0 if the arena is exhausted
+ *      or a chunk could not be allocated.
+ *
+ * implementation details: the index is only claimed, by a compare and
+ *      swap on nextNode, once its chunk exists, so a failed allocation or a
+ *      full arena leaves nextNode unchanged and it never passes the number
+ *      of nodes the arena holds.  The first thread to need a chunk allocates
+ *      it and installs it with a compare and swap.  A thread that loses the
+ *      race frees its copy and uses the installed chunk.
+ */
+uint32_t allocateNode(ConcurrentStack * stack){
+    uint32_t index = popNode(stack, &stack->freeNodes);
+    if(index != 0){
+        return index;
+    }
+    index = atomic_load_explicit(&stack->nextNode, memory_order_relaxed);
+    do{
+        if(index >= (uint32_t)CS_CHUNK_SIZE * CS_MAX_CHUNKS){
+            return 0;
+        }
+        ConcurrentStackNode * _Atomic * slot = &stack->chunks[index / CS_CHUNK_SIZE];
+        if(atomic_load_explicit(slot, memory_order_acquire) == NULL){
+            ConcurrentStackNode * expected = NULL;
+            ConcurrentStackNode * chunk = malloc(sizeof(ConcurrentStackNode) * CS_CHUNK_SIZE);
+            if(chunk == NULL){
+                return 0;
+            }
+            if(!atomic_compare_exchange_strong_explicit(slot, &expected, chunk, memory_order_acq_rel, memory_order_acquire)){
+                free(chunk);
+            }
+        }
+    }while(!atomic_compare_exchange_weak_explicit(&stack->nextNode, &index, index + 1, memory_order_relaxed, memory_order_relaxed));
+    return index + 1;
+}
+
+/**end internal functions**/
+
+/*
+ * Function: createConcurrentStack
+ * ----------------------------
+ * Creates a pointer to a concurrent stack data structure
+ *
+ * destroyFunc: a function pointer that destroys the data type intended
+ *      to be stored in the stack
+ *
+ * return: a pointer to the created stack.  NULL if failed.
+ */
+ConcurrentStack * createConcurrentStack(void (*destroyFunc)(void * data)){
+    ConcurrentStack * stack = malloc(sizeof(ConcurrentStack));
+    if(stack == NULL){
+        return NULL;
+    }
+    atomic_init(&stack->top, 0);
+    atomic_init(&stack->freeNodes, 0);
+    atomic_init(&stack->nextNode, 0);
+    for(int i = 0; i < CS_MAX_CHUNKS; i++){
+        atomic_init(&stack->chunks[i], NULL);
+    }
+    stack->destroyData = destroyFunc;
+    return stack;
+}
+
+/*
+ * Function: pushConcurrent
+ * ----------------------------
+ * Adds new data to the top of the stack.  Safe to call from any number of
+ *      threads.
+ *
+ * stack: the stack to perform the push operation on.
+ * data: the data to added to the top of the stack.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int pushConcurrent(ConcurrentStack * stack, void * data){
+    if(stack == NULL){
+        return 0;
+    }
+    uint32_t index = allocateNode(stack);
+    if(index == 0){
+        return 0;
+    }
+    nodeAt(stack, index)->data = data;
+    pushNode(stack, &stack->top, index);
+    return 1;
+}
+
+/*
+ * Function: popConcurrent
+ * ----------------------------
+ * removes the item on the top of the stack and returns the data.  Safe to
+ *      call from any number of threads.
+ *
+ * stack: the stack to perform the pop operation on.
+ *
+ * return: a void pointer of the data stored in the top of the
+ *     stack.  NULL if the stack is empty.
+ */
+void * popConcurrent(ConcurrentStack * stack){
+    if(stack == NULL){
+        return NULL;
+    }
+    uint32_t index = popNode(stack, &stack->top);
+    if(index == 0){
+        return NULL;
+    }
+    void * data = nodeAt(stack, index)->data;
+    pushNode(stack, &stack->freeNodes, index);
+    return data;
+}
+
+/*
+ * Function: destroyConcurrentStack
+ * ----------------------------
+ * Frees the stack and all data stored in the stack using the destroyData
+ *      function pointer
+ *
+ * stack: the stack to perform the destroy operation on.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ *
+ * note: No other thread may be using the stack when it is destroyed.
+ */
+int destroyConcurrentStack(ConcurrentStack * stack){
+    if(stack == NULL){
+        return 0;
+    }
+    uint32_t index = CS_INDEX(atomic_load(&stack->top));
+    while(index != 0){
+        ConcurrentStackNode * node = nodeAt(stack, index);
+        stack->destroyData(node->data);
+        index = atomic_load_explicit(&node->next, memory_order_relaxed);
+    }
+    for(int i = 0; i < CS_MAX_CHUNKS; i++){
+        free(atomic_load(&stack->chunks[i]));
+    }
+    free(stack);
+    return 1;
+}
@@ -0,0 +1,98 @@
+#include "intrusiveStack.h"
+
+/*
+ * Function: createIntrusiveStack
+ * ----------------------------
+ * Creates a pointer to an intrusive stack data structure
+ *
+ * offset: the offset of the StackLink within the items, e.g.
+ *      offsetof(Frame, link).  An item may be in several stacks at once
+ *      through different links.
+ * destroyFunc: a function pointer that destroys the items left in the
+ *      stack when it is destroyed.  May be NULL.
+ *
+ * return: a pointer to the created stack.  NULL if failed.
+ */
+IntrusiveStack * createIntrusiveStack(size_t offset, void (*destroyFunc)(void * data)){
+    IntrusiveStack * stack = malloc(sizeof(IntrusiveStack));
+    if(stack == NULL){
+        return NULL;
+    }
+    stack->top = NULL;
+    stack->offset = offset;
+    stack->destroyData = destroyFunc;
+    stack->size = 0;
+    return stack;
+}
+
+/*
+ * Function: pushIntrusive
+ * ----------------------------
+ * Adds an item to the top of the stack
+ *
+ * stack: the stack to perform the push operation on.
+ * data: the item to add.  Its link must not be in use by another stack.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int pushIntrusive(IntrusiveStack * stack, void * data){
+    if(stack == NULL || data == NULL){
+        return 0;
+    }
+    StackLink * link = (StackLink *)((char *)data + stack->offset);
+    link->next = stack->top;
+    stack->top = link;
+    stack->size++;
+    return 1;
+}
+
+/*
+ * Function: popIntrusive
+ * ----------------------------
+ * removes the top item of the stack and returns it.  Its link may be used
+ *      to add it to another stack straight away.
+ *
+ * stack: the stack to perform the pop operation on.
+ *
+ * return: the item on top of the stack.  NULL if empty.
+ */
+void * popIntrusive(IntrusiveStack * stack){
+    if(stack == NULL || stack->top == NULL){
+        return NULL;
+    }
+    StackLink * link = stack->top;
+    stack->top = link->next;
+    link->next = NULL;
+    stack->size--;
+    return (char *)link - stack->offset;
+}
+
+/*
+ * Function: destroyIntrusiveStack
+ * ----------------------------
+ * Frees the stack, and the items left in it if it has a destroyData.
+ *
+ * stack: the stack to perform the destroy operation on.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int destroyIntrusiveStack(IntrusiveStack * stack){
+    if(stack == NULL){
+        return 0;
+    }
+    StackLink * link = stack->top;
+    StackLink * temp;
+    while(link != NULL){
+        temp = link->next;
+        if(stack->destroyData != NULL){
+            stack->destroyData((char *)link - stack->offset);
+        }
+        link = temp;
+    }
+    free(stack);
+    return 1;
+}
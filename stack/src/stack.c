@@ -1,12 +1,23 @@
+#include <string.h>
 #include "stack.h"
 
 /**internal functions**/
 
-StackNode * createStackNode(StackNode * next, void * data){
-    StackNode * node = malloc(sizeof(StackNode));
-    node->next = next;
-    node->data = data;
-    return node;
+/*
+ * Function: resizeStack
+ * ----------------------------
+ * reallocates the array of the stack to hold exactly capacity items.
+ * 
+ * return: 1 if sucessful. 0 if failed.
+ */
+int resizeStack(Stack * stack, int capacity){
+    void ** items = realloc(stack->items, sizeof(void *) * capacity);
+    if(items == NULL){
+        return 0;
+    }
+    stack->items = items;
+    stack->capacity = capacity;
+    return 1;
 }
 
 /**end internal functions**/
@@ -19,16 +30,74 @@ StackNode * createStackNode(StackNode * next, void * data){
  * destroyFunc: a function pointer that destroys the data type intended
  *      to be stored in the stack
  * 
- * return: a pointer to the created stack
+ * return: a pointer to the created stack.  NULL if failed.
  */
 Stack * createStack(void (*destroyFunc)(void * data)){
     Stack * stack = malloc(sizeof(Stack));
+    if(stack == NULL){
+        return NULL;
+    }
+    stack->items = malloc(sizeof(void *) * STACK_INITIAL_CAPACITY);
+    if(stack->items == NULL){
+        free(stack);
+        return NULL;
+    }
+    stack->capacity = STACK_INITIAL_CAPACITY;
+    stack->reserved = STACK_INITIAL_CAPACITY;
+    stack->shrink = 0;
     stack->size = 0;
     stack->destroyData = destroyFunc;
-    stack->top = NULL;
     return stack;
 }
 
+/*
+ * Function: reserveStack
+ * ----------------------------
+ * Grows the stack so it can hold at least capacity items without
+ *      reallocating.
+ * 
+ * stack: the stack to perform the reserve operation on.
+ * capacity: the number of items the stack must be able to hold.
+ * 
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int reserveStack(Stack * stack, int capacity){
+    if(stack == NULL || capacity < 0){
+        return 0;
+    }
+    if(capacity > stack->capacity && !resizeStack(stack, capacity)){
+        return 0;
+    }
+    if(capacity > stack->reserved){
+        stack->reserved = capacity;
+    }
+    return 1;
+}
+
+/*
+ * Function: setStackShrink
+ * ----------------------------
+ * Enables or disables releasing memory as the stack empties.  When enabled
+ *      the array is halved once the stack falls to a quarter of its capacity,
+ *      so alternating push and pop at a boundary does not reallocate.
+ * 
+ * stack: the stack to configure.
+ * shrink: 1 to enable shrinking. 0 to disable it.
+ * 
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ */
+int setStackShrink(Stack * stack, int shrink){
+    if(stack == NULL){
+        return 0;
+    }
+    stack->shrink = shrink != 0;
+    return 1;
+}
+
 /*
  * Function: push
  * ----------------------------
@@ -45,9 +114,10 @@ int push(Stack * stack, void * data){
     if(stack == NULL){
         return 0;
     }
-    StackNode * oldTop = stack->top;
-    StackNode * node = createStackNode(oldTop, data);
-    stack->top = node;
+    if(stack->size == stack->capacity && !resizeStack(stack, stack->capacity * 2)){
+        return 0;
+    }
+    stack->items[stack->size] = data;
     stack->size++;
     return 1;
 }
@@ -59,24 +129,95 @@ int push(Stack * stack, void * data){
  * 
  * stack: the stack to perform the pop operation on.
  * 
- * return: a void pointer of the data stored in the top of the 
+ * return: a void pointer of the data stored in the top of the
  *     stack.
  */
 void * pop(Stack * stack){
     if(stack == NULL){
         return NULL;
     }
-    if(stack->top == NULL){
+    if(stack->size == 0){
         return NULL;
     }
-    StackNode * node = stack->top;
-    void * data = node->data;
-    stack->top = node->next;
-    free(node);
     stack->size--;
+    void * data = stack->items[stack->size];
+    if(stack->shrink && stack->size <= stack->capacity / 4 && stack->capacity / 2 >= stack->reserved){
+        resizeStack(stack, stack->capacity / 2);
+    }
     return data;
 }
 
+/*
+ * Function: pushMany
+ * ----------------------------
+ * Adds count items to the top of the stack in order, so the last item ends
+ *      up on top.  The array is grown once for the whole batch and the items
+ *      are copied in as one block.
+ * 
+ * stack: the stack to perform the push operation on.
+ * items: the data to be added, bottom item first.
+ * count: the number of items.
+ * 
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure, no items were added
+ * 1: success
+ */
+int pushMany(Stack * stack, void ** items, int count){
+    if(stack == NULL || count < 0 || (items == NULL && count > 0)){
+        return 0;
+    }
+    if(count == 0){
+        return 1;
+    }
+    if(stack->size + count > stack->capacity){
+        int capacity = stack->capacity;
+        while(capacity < stack->size + count){
+            capacity *= 2;
+        }
+        if(!resizeStack(stack, capacity)){
+            return 0;
+        }
+    }
+    memcpy(stack->items + stack->size, items, sizeof(void *) * count);
+    stack->size += count;
+    return 1;
+}
+
+/*
+ * Function: popMany
+ * ----------------------------
+ * removes up to count items from the top of the stack into an array.
+ * 
+ * stack: the stack to perform the pop operation on.
+ * items: filled with the removed data, top of the stack first, in the
+ *      order pop would have returned them.
+ * count: the size of items.
+ * 
+ * return: the number of items removed.  0 if the stack is empty or NULL.
+ */
+int popMany(Stack * stack, void ** items, int count){
+    if(stack == NULL || count <= 0 || items == NULL){
+        return 0;
+    }
+    if(count > stack->size){
+        count = stack->size;
+    }
+    for(int i = 0; i < count; i++){
+        items[i] = stack->items[stack->size - 1 - i];
+    }
+    stack->size -= count;
+    if(stack->shrink){
+        int capacity = stack->capacity;
+        while(stack->size <= capacity / 4 && capacity / 2 >= stack->reserved){
+            capacity /= 2;
+        }
+        if(capacity != stack->capacity){
+            resizeStack(stack, capacity);
+        }
+    }
+    return count;
+}
+
 /*
  * Function: destroyStack
  * ----------------------------
@@ -97,14 +238,109 @@ int destroyStack(Stack * stack){
     if(stack == NULL){
         return 0;
     }
-    StackNode * node = stack->top;
-    StackNode * temp;
-    while(node != NULL){
-        stack->destroyData(node->data);
-        temp = node->next;
-        free(node);
-        node = temp;
+    for(int i = stack->size - 1; i >= 0; i--){
+        stack->destroyData(stack->items[i]);
     }
+    free(stack->items);
     free(stack);
     return 1;
+}
+
+/*
+ * Function: iterBeginStack
+ * ----------------------------
+ * Creates an iterator positioned at the top of the stack, the next item
+ *      to be popped.
+ * 
+ * stack: the stack to iterate over.
+ * 
+ * return: an iterator on the top item.  The iterator is not valid if the
+ *      stack is empty or NULL.
+ */
+StackIterator iterBeginStack(Stack * stack){
+    StackIterator iterator;
+    iterator.stack = stack;
+    iterator.position = stack == NULL ? -1 : stack->size - 1;
+    return iterator;
+}
+
+/*
+ * Function: iterEndStack
+ * ----------------------------
+ * Creates an iterator positioned at the bottom of the stack, for walking
+ *      the stack from the bottom up.
+ * 
+ * stack: the stack to iterate over.
+ * 
+ * return: an iterator on the bottom item.  The iterator is not valid if the
+ *      stack is empty or NULL.
+ */
+StackIterator iterEndStack(Stack * stack){
+    StackIterator iterator;
+    iterator.stack = stack;
+    iterator.position = 0;
+    return iterator;
+}
+
+/*
+ * Function: iterValidStack
+ * ----------------------------
+ * Checks whether the iterator is positioned on an item.
+ * 
+ * iterator: the iterator to check.
+ * 
+ * return: 1 if the iterator is on an item. 0 if it has run off either end.
+ */
+int iterValidStack(StackIterator * iterator){
+    return iterator != NULL && iterator->stack != NULL && iterator->position >= 0 && iterator->position < iterator->stack->size;
+}
+
+/*
+ * Function: iterGetStack
+ * ----------------------------
+ * retrieve the item the iterator is positioned on.
+ * 
+ * iterator: the iterator to read.
+ * 
+ * return: a pointer of the data at the iterator.  NULL if not valid.
+ */
+void * iterGetStack(StackIterator * iterator){
+    if(!iterValidStack(iterator)){
+        return NULL;
+    }
+    return iterator->stack->items[iterator->position];
+}
+
+/*
+ * Function: iterNextStack
+ * ----------------------------
+ * moves the iterator one item towards the bottom of the stack.
+ * 
+ * iterator: the iterator to move.
+ * 
+ * return: 1 if the iterator is on an item after moving. 0 otherwise.
+ */
+int iterNextStack(StackIterator * iterator){
+    if(!iterValidStack(iterator)){
+        return 0;
+    }
+    iterator->position--;
+    return iterValidStack(iterator);
+}
+
+/*
+ * Function: iterPrevStack
+ * ----------------------------
+ * moves the iterator one item towards the top of the stack.
+ * 
+ * iterator: the iterator to move.
+ * 
+ * return: 1 if the iterator is on an item after moving. 0 otherwise.
+ */
+int iterPrevStack(StackIterator * iterator){
+    if(!iterValidStack(iterator)){
+        return 0;
+    }
+    iterator->position++;
+    return iterValidStack(iterator);
 }
\ No newline at end of file
@@ -0,0 +1,241 @@
+#include "workStealingDeque.h"
+
+/**internal functions**/
+
+/*
+ * Function: createArrayWS
+ * ----------------------------
+ * allocates an empty circular array that holds capacity items.
+ *
+ * return: a pointer to the array.  NULL if failed.
+ */
+WorkStealingArray * createArrayWS(int64_t capacity){
+    WorkStealingArray * array = malloc(sizeof(WorkStealingArray) + sizeof(void *) * capacity);
+    if(array == NULL){
+        return NULL;
+    }
+    array->capacity = capacity;
+    array->previous = NULL;
+    return array;
+}
+
+/*
+ * Function: growWS
+ * ----------------------------
+ * replaces the deque's array with one twice the size holding the items
+ *      from top to bottom.  The old array is kept for thieves that may
+ *      still be reading it.
+ *
+ * return: the new array.  NULL if failed.
+ */
+WorkStealingArray * growWS(WorkStealingDeque * deque, WorkStealingArray * array, int64_t top, int64_t bottom){
+    WorkStealingArray * grown = createArrayWS(array->capacity * 2);
+    if(grown == NULL){
+        return NULL;
+    }
+    for(int64_t i = top; i < bottom; i++){
+        void * data = atomic_load_explicit(&array->items[i & (array->capacity - 1)], memory_order_relaxed);
+        atomic_store_explicit(&grown->items[i & (grown->capacity - 1)], data, memory_order_relaxed);
+    }
+    grown->previous = array;
+    atomic_store_explicit(&deque->array, grown, memory_order_release);
+    return grown;
+}
+
+/**end internal functions**/
+
+/*
+ * Function: createWorkStealingDeque
+ * ----------------------------
+ * Creates a pointer to a work stealing deque data structure
+ *
+ * destroyFunc: a function pointer that destroys the data type intended
+ *      to be stored in the deque
+ *
+ * return: a pointer to the created deque.  NULL if failed.
+ */
+WorkStealingDeque * createWorkStealingDeque(void (*destroyFunc)(void * data)){
+    WorkStealingDeque * deque = aligned_alloc(WS_CACHE_LINE, sizeof(WorkStealingDeque));
+    if(deque == NULL){
+        return NULL;
+    }
+    WorkStealingArray * array = createArrayWS(WS_INITIAL_CAPACITY);
+    if(array == NULL){
+        free(deque);
+        return NULL;
+    }
+    atomic_init(&deque->top, 0);
+    atomic_init(&deque->bottom, 0);
+    atomic_init(&deque->array, array);
+    deque->destroyData = destroyFunc;
+    return deque;
+}
+
+/*
+ * Function: pushWorkStealing
+ * ----------------------------
+ * Adds new data to the bottom of the deque, growing the array if it is
+ *      full.  Only the owner thread may call it.
+ *
+ * deque: the deque to perform the push operation on.
+ * data: the data to added to the bottom of the deque.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ *
+ * implementation details: the item is written before bottom is released,
+ *      so a thief that sees the new bottom also sees the item.
+ */
+int pushWorkStealing(WorkStealingDeque * deque, void * data){
+    if(deque == NULL){
+        return 0;
+    }
+    int64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+    int64_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    WorkStealingArray * array = atomic_load_explicit(&deque->array, memory_order_relaxed);
+    if(bottom - top >= array->capacity){
+        array = growWS(deque, array, top, bottom);
+        if(array == NULL){
+            return 0;
+        }
+    }
+    atomic_store_explicit(&array->items[bottom & (array->capacity - 1)], data, memory_order_relaxed);
+    atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_release);
+    return 1;
+}
+
+/*
+ * Function: popWorkStealing
+ * ----------------------------
+ * removes the item on the bottom of the deque, the most recently pushed,
+ *      and returns the data.  Only the owner thread may call it.
+ *
+ * deque: the deque to perform the pop operation on.
+ *
+ * return: a void pointer of the data stored in the bottom of the
+ *     deque.  NULL if the deque is empty or a thief took the last item.
+ *
+ * implementation details: bottom is lowered first to claim the item, and
+ *      the fence orders that before reading top, so a thief either sees the
+ *      lower bottom or the owner sees the thief's top.  Only when a single
+ *      item is left do the owner and thieves race for it with a compare and
+ *      swap on top.
+ */
+void * popWorkStealing(WorkStealingDeque * deque){
+    if(deque == NULL){
+        return NULL;
+    }
+    int64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+    WorkStealingArray * array = atomic_load_explicit(&deque->array, memory_order_relaxed);
+    atomic_store_explicit(&deque->bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    int64_t top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+    void * data = NULL;
+    if(top <= bottom){
+        data = atomic_load_explicit(&array->items[bottom & (array->capacity - 1)], memory_order_relaxed);
+        if(top == bottom){
+            if(!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+                                                        memory_order_seq_cst, memory_order_relaxed)){
+                data = NULL;
+            }
+            atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+        }
+    }
+    else{
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+    }
+    return data;
+}
+
+/*
+ * Function: stealWorkStealing
+ * ----------------------------
+ * removes the item on the top of the deque, the least recently pushed.
+ *      Safe to call from any number of threads other than the owner.
+ *
+ * deque: the deque to perform the steal operation on.
+ * data: set to the removed data on success.
+ *
+ * return: an integer indicating the result of the operation
+ * -1: another thread took the top item first.  The deque may not be empty,
+ *      so the steal may be retried.
+ * 0: failure, the deque is empty or NULL
+ * 1: success
+ *
+ * implementation details: the item is read before the compare and swap
+ *      on top claims it, since once top moves the owner may overwrite its
+ *      slot.  A failed compare and swap discards the read.
+ */
+int stealWorkStealing(WorkStealingDeque * deque, void ** data){
+    if(deque == NULL || data == NULL){
+        return 0;
+    }
+    int64_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    int64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+    if(top >= bottom){
+        return 0;
+    }
+    WorkStealingArray * array = atomic_load_explicit(&deque->array, memory_order_acquire);
+    void * item = atomic_load_explicit(&array->items[top & (array->capacity - 1)], memory_order_relaxed);
+    if(!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1,
+                                                memory_order_seq_cst, memory_order_relaxed)){
+        return -1;
+    }
+    *data = item;
+    return 1;
+}
+
+/*
+ * Function: sizeWorkStealing
+ * ----------------------------
+ * returns the number of items in the deque.  The value is a snapshot and
+ *      may be stale by the time it is used if other threads are active.
+ *
+ * deque: the deque to measure.
+ *
+ * return: the number of items in the deque.  -1 if the deque is NULL.
+ */
+int sizeWorkStealing(WorkStealingDeque * deque){
+    if(deque == NULL){
+        return -1;
+    }
+    int64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+    int64_t top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    return bottom > top ? bottom - top : 0;
+}
+
+/*
+ * Function: destroyWorkStealingDeque
+ * ----------------------------
+ * Frees the deque and all data stored in the deque using the destroyData
+ *      function pointer
+ *
+ * deque: the deque to perform the destroy operation on.
+ *
+ * return: an integer indicating the success or failure of the operation
+ * 0: failure
+ * 1: success
+ *
+ * note: No other thread may be using the deque when it is destroyed.  Data
+ *      that was popped or stolen belongs to the caller and is not destroyed.
+ */
+int destroyWorkStealingDeque(WorkStealingDeque * deque){
+    if(deque == NULL){
+        return 0;
+    }
+    int64_t top = atomic_load_explicit(&deque->top, memory_order_relaxed);
+    int64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+    WorkStealingArray * array = atomic_load_explicit(&deque->array, memory_order_relaxed);
+    for(int64_t i = bottom - 1; i >= top; i--){
+        deque->destroyData(atomic_load_explicit(&array->items[i & (array->capacity - 1)], memory_order_relaxed));
+    }
+    while(array != NULL){
+        WorkStealingArray * previous = array->previous;
+        free(array);
+        array = previous;
+    }
+    free(deque);
+    return 1;
+}
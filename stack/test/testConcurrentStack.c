@@ -0,0 +1,153 @@
+#include <pthread.h>
+#include "unity.h"
+#include "concurrentStack.h"
+
+#define THREADS 8
+#define ITEMS_PER_THREAD 100000
+
+/*
+ * Struct: TestStruct
+ * ----------------------------
+ * A data structure used for testing
+ */
+typedef struct testingStruct{
+    int num;
+    char letter;
+}TestStruct;
+
+/*
+ * Function: createTestingStruct
+ * ----------------------------
+ * Allocates and sets a structure used for testing the ConcurrentStack data structure.
+ * 
+ * Created to keep DRY (Don't Repeated Yourself)
+ */
+TestStruct * createTestingStruct(int num, char c){
+    TestStruct * test = malloc(sizeof(TestStruct));
+    test->num = num;
+    test->letter = c;
+    return test;
+}
+
+void destroyFunc(void * data){
+    free(data);
+}
+
+void noDestroyFunc(void * data){
+}
+
+void setUp(void) {
+    // set stuff up here
+
+}
+
+void tearDown(void) {
+    // clean stuff up here
+}
+
+/*
+ * Test: test_create_concurrent_stack
+ * ----------------------------
+ * Ensure the createConcurrentStack function works as expected
+ */
+void test_create_concurrent_stack(void){
+    ConcurrentStack * stack = createConcurrentStack(&destroyFunc);
+    TEST_ASSERT_NOT_NULL_MESSAGE(stack, "createConcurrentStack returned null pointer");
+    TEST_ASSERT_NULL_MESSAGE(popConcurrent(stack), "new stack is not empty");
+    destroyConcurrentStack(stack);
+}
+
+/*
+ * Test: test_null_concurrent_stack
+ * ----------------------------
+ * Test that a NULL stack is handled gracefully.
+ */
+void test_null_concurrent_stack(void){
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, pushConcurrent(NULL, NULL), "NULL push did not fail");
+    TEST_ASSERT_NULL_MESSAGE(popConcurrent(NULL), "NULL pop did not return NULL");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, destroyConcurrentStack(NULL), "NULL destroy did not fail");
+}
+
+/*
+ * Test: test_concurrent_push_pop
+ * ----------------------------
+ * Test that the stack is LIFO and reuses popped nodes.
+ */
+void test_concurrent_push_pop(void){
+    ConcurrentStack * stack = createConcurrentStack(&destroyFunc);
+    TestStruct * test;
+    for(int i = 0; i < CS_CHUNK_SIZE + 10; i++){
+        TEST_ASSERT_EQUAL_INT_MESSAGE(1, pushConcurrent(stack, createTestingStruct(i, 'a')), "push failed");
+    }
+    for(int i = CS_CHUNK_SIZE + 9; i >= 10; i--){
+        test = popConcurrent(stack);
+        TEST_ASSERT_EQUAL_INT_MESSAGE(i, test->num, "pop returned incorrect data");
+        free(test);
+    }
+    pushConcurrent(stack, createTestingStruct(100, 'b'));
+    TEST_ASSERT_EQUAL_INT_MESSAGE(CS_CHUNK_SIZE + 10, atomic_load(&stack->nextNode), "popped node was not reused");
+    test = popConcurrent(stack);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(100, test->num, "pop returned incorrect data after reuse");
+    free(test);
+    destroyConcurrentStack(stack);
+}
+
+ConcurrentStack * sharedStack;
+int popped[THREADS * ITEMS_PER_THREAD];
+
+void * pushPopThread(void * arg){
+    int first = *(int*)arg * ITEMS_PER_THREAD;
+    int * slot;
+    for(int i = 0; i < ITEMS_PER_THREAD; i++){
+        pushConcurrent(sharedStack, &popped[first + i]);
+        if(i % 2 == 1){
+            slot = popConcurrent(sharedStack);
+            (*slot)++;
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Test: test_concurrent_threads
+ * ----------------------------
+ * Test that items pushed and popped by many threads at once are each
+ *      popped exactly once.
+ */
+void test_concurrent_threads(void){
+    pthread_t threads[THREADS];
+    int ids[THREADS];
+    int * slot;
+    int missing = 0;
+    int duplicates = 0;
+
+    sharedStack = createConcurrentStack(&noDestroyFunc);
+    for(int i = 0; i < THREADS; i++){
+        ids[i] = i;
+        pthread_create(&threads[i], NULL, &pushPopThread, &ids[i]);
+    }
+    for(int i = 0; i < THREADS; i++){
+        pthread_join(threads[i], NULL);
+    }
+    while((slot = popConcurrent(sharedStack)) != NULL){
+        (*slot)++;
+    }
+    for(int i = 0; i < THREADS * ITEMS_PER_THREAD; i++){
+        missing += popped[i] == 0;
+        duplicates += popped[i] > 1;
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, missing, "items were lost");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, duplicates, "items were popped more than once");
+    destroyConcurrentStack(sharedStack);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    
+    RUN_TEST(test_create_concurrent_stack);
+    RUN_TEST(test_null_concurrent_stack);
+    RUN_TEST(test_concurrent_push_pop);
+    RUN_TEST(test_concurrent_threads);
+
+    return UNITY_END();
+}
@@ -0,0 +1,100 @@
+#include "unity.h"
+#include "intrusiveStack.h"
+
+/*
+ * Struct: Frame
+ * ----------------------------
+ * An item with a stack link.
+ */
+typedef struct frame{
+    int id;
+    StackLink link;
+}Frame;
+
+int destroyed;
+
+void countDestroy(void * data){
+    destroyed++;
+}
+
+void setUp(void) {
+    // set stuff up here
+    destroyed = 0;
+}
+
+void tearDown(void) {
+    // clean stuff up here
+}
+
+/*
+ * Test: test_intrusive_stack_null
+ * ----------------------------
+ * Test that the intrusive stack functions handle NULL and empty stacks.
+ */
+void test_intrusive_stack_null(void){
+    IntrusiveStack * stack = createIntrusiveStack(offsetof(Frame, link), NULL);
+    Frame frame = {1};
+    TEST_ASSERT_NOT_NULL_MESSAGE(stack, "createIntrusiveStack returned NULL");
+    TEST_ASSERT_EQUAL_INT(0, pushIntrusive(NULL, &frame));
+    TEST_ASSERT_EQUAL_INT(0, pushIntrusive(stack, NULL));
+    TEST_ASSERT_NULL(popIntrusive(NULL));
+    TEST_ASSERT_NULL(popIntrusive(stack));
+    TEST_ASSERT_EQUAL_INT(0, destroyIntrusiveStack(NULL));
+    TEST_ASSERT_EQUAL_INT(1, destroyIntrusiveStack(stack));
+}
+
+/*
+ * Test: test_intrusive_stack_order
+ * ----------------------------
+ * Test that items come off in reverse order, and moving items between
+ *      stacks.
+ */
+void test_intrusive_stack_order(void){
+    Frame frames[100];
+    IntrusiveStack * stack = createIntrusiveStack(offsetof(Frame, link), NULL);
+    IntrusiveStack * other = createIntrusiveStack(offsetof(Frame, link), NULL);
+    for(int i = 0; i < 100; i++){
+        frames[i].id = i;
+        TEST_ASSERT_EQUAL_INT(1, pushIntrusive(stack, &frames[i]));
+    }
+    TEST_ASSERT_EQUAL_INT(100, stack->size);
+    for(int i = 99; i >= 0; i--){
+        Frame * frame = popIntrusive(stack);
+        TEST_ASSERT_EQUAL_PTR_MESSAGE(&frames[i], frame, "popped out of order");
+        pushIntrusive(other, frame);
+    }
+    TEST_ASSERT_NULL(popIntrusive(stack));
+    TEST_ASSERT_EQUAL_INT(0, stack->size);
+    for(int i = 0; i < 100; i++){
+        TEST_ASSERT_EQUAL_PTR_MESSAGE(&frames[i], popIntrusive(other), "moved items out of order");
+    }
+    destroyIntrusiveStack(stack);
+    destroyIntrusiveStack(other);
+}
+
+/*
+ * Test: test_intrusive_stack_destroy
+ * ----------------------------
+ * Test that destroyData is called for each item left in the stack.
+ */
+void test_intrusive_stack_destroy(void){
+    Frame frames[10];
+    IntrusiveStack * stack = createIntrusiveStack(offsetof(Frame, link), &countDestroy);
+    for(int i = 0; i < 10; i++){
+        pushIntrusive(stack, &frames[i]);
+    }
+    popIntrusive(stack);
+    destroyIntrusiveStack(stack);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(9, destroyed, "destroyData not called for each item left");
+}
+
+int main(void) {
+
+    UNITY_BEGIN();
+
+    RUN_TEST(test_intrusive_stack_null);
+    RUN_TEST(test_intrusive_stack_order);
+    RUN_TEST(test_intrusive_stack_destroy);
+
+    return UNITY_END();
+}
@@ -60,9 +60,9 @@ void test_push(void){
 
     int code = push(stack, test);
 
-    TEST_ASSERT_NOT_NULL_MESSAGE(stack->top, "top of stack is NULL after push");
-    TEST_ASSERT_NOT_NULL_MESSAGE(stack->top->data, "data not stored in stack");
-    TEST_ASSERT_EQUAL_INT_MESSAGE(((TestStruct*)stack->top->data)->num, 1, "incorrect data stored in stack");
+    TEST_ASSERT_NOT_NULL_MESSAGE(stack->items, "item array of stack is NULL after push");
+    TEST_ASSERT_NOT_NULL_MESSAGE(stack->items[stack->size - 1], "data not stored in stack");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(((TestStruct*)stack->items[stack->size - 1])->num, 1, "incorrect data stored in stack");
     TEST_ASSERT_EQUAL_INT_MESSAGE(stack->size, 1, "incorrect stack size after push");
     TEST_ASSERT_EQUAL_INT_MESSAGE(code, 1, "incorrect status code return from push");
 
@@ -175,6 +175,124 @@ void test_large_queue(void){
     destroyStack(stack);
 }
 
+/*
+ * Test: test_reserve
+ * ----------------------------
+ * Test that reserveStack pre-sizes the stack so pushing up to the reserved
+ *      capacity does not reallocate.
+ */
+void test_reserve(void){
+    Stack * stack = createStack(&destroyFunc);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, reserveStack(NULL, 10), "reserve did not fail on NULL stack");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, reserveStack(stack, 1000), "reserve failed");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1000, stack->capacity, "reserve did not grow the stack");
+
+    void ** items = stack->items;
+    for(int i = 0; i < 1000; i++){
+        push(stack, createTestingStruct(i, 'a'));
+    }
+    TEST_ASSERT_MESSAGE(items == stack->items, "stack reallocated within its reserved capacity");
+    push(stack, createTestingStruct(1000, 'a'));
+    TEST_ASSERT_EQUAL_INT_MESSAGE(2000, stack->capacity, "stack did not double when full");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1001, stack->size, "stack size incorrect after growth");
+    destroyStack(stack);
+}
+
+/*
+ * Test: test_shrink
+ * ----------------------------
+ * Test that a shrinking stack halves once it is a quarter full and never
+ *      shrinks below its initial capacity.
+ */
+void test_shrink(void){
+    Stack * stack = createStack(&destroyFunc);
+    TestStruct * test;
+    setStackShrink(stack, 1);
+    for(int i = 0; i < STACK_INITIAL_CAPACITY * 8; i++){
+        push(stack, createTestingStruct(i, 'a'));
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(STACK_INITIAL_CAPACITY * 8, stack->capacity, "stack capacity incorrect after growth");
+    while(stack->size > STACK_INITIAL_CAPACITY * 2 + 1){
+        free(pop(stack));
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(STACK_INITIAL_CAPACITY * 8, stack->capacity, "stack shrank before it was a quarter full");
+    free(pop(stack));
+    TEST_ASSERT_EQUAL_INT_MESSAGE(STACK_INITIAL_CAPACITY * 4, stack->capacity, "stack did not shrink at a quarter full");
+    while(stack->size > 1){
+        free(pop(stack));
+    }
+    test = pop(stack);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, test->num, "pop returned incorrect data after shrinking");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(STACK_INITIAL_CAPACITY, stack->capacity, "stack shrank below its initial capacity");
+    free(test);
+    destroyStack(stack);
+}
+
+/*
+ * Test: test_push_pop_many
+ * ----------------------------
+ * Test that pushMany grows the stack once and keeps the order of push, and
+ *      that popMany returns the items in the order of pop and shrinks.
+ */
+void test_push_pop_many(void){
+    Stack * stack = createStack(&destroyFunc);
+    int count = STACK_INITIAL_CAPACITY * 8;
+    void * items[STACK_INITIAL_CAPACITY * 8];
+    void * popped[STACK_INITIAL_CAPACITY * 8];
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, pushMany(NULL, items, 1), "pushMany did not fail on NULL stack");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, pushMany(stack, NULL, 1), "pushMany did not fail on NULL items");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, pushMany(stack, NULL, 0), "pushMany failed on an empty batch");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, popMany(NULL, popped, 1), "popMany removed from NULL stack");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, popMany(stack, popped, 1), "popMany removed from empty stack");
+
+    for(int i = 0; i < count; i++){
+        items[i] = createTestingStruct(i, 'a');
+    }
+    push(stack, items[0]);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, pushMany(stack, items + 1, count - 1), "pushMany failed");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(count, stack->size, "stack size incorrect after pushMany");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(count, stack->capacity, "pushMany did not grow to the next power of two");
+
+    setStackShrink(stack, 1);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(count - 1, popMany(stack, popped, count - 1), "popMany removed the wrong number of items");
+    for(int i = 0; i < count - 1; i++){
+        TEST_ASSERT_MESSAGE(popped[i] == items[count - 1 - i], "popMany did not return items in pop order");
+        free(popped[i]);
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(STACK_INITIAL_CAPACITY, stack->capacity, "popMany did not shrink the stack");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, popMany(stack, popped, count), "popMany removed more than the stack held");
+    TEST_ASSERT_MESSAGE(popped[0] == items[0], "popMany returned incorrect bottom item");
+    free(popped[0]);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, stack->size, "stack not empty after popMany");
+    destroyStack(stack);
+}
+
+/*
+ * Test: test_iterator
+ * ----------------------------
+ * Test that an iterator walks the stack top to bottom and bottom to top.
+ */
+void test_iterator(void){
+    Stack * stack = createStack(&destroyFunc);
+    StackIterator iterator = iterBeginStack(stack);
+    int count = 20;
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, iterValidStack(&iterator), "iterator valid on empty stack");
+    for(int i = 0; i < 20; i++){
+        push(stack, createTestingStruct(i, 'a'));
+    }
+    for(iterator = iterBeginStack(stack); iterValidStack(&iterator); iterNextStack(&iterator)){
+        count--;
+        TEST_ASSERT_EQUAL_INT_MESSAGE(count, ((TestStruct*)iterGetStack(&iterator))->num, "top down iteration out of order");
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, count, "top down iteration missed items");
+    for(iterator = iterEndStack(stack); iterValidStack(&iterator); iterPrevStack(&iterator)){
+        TEST_ASSERT_EQUAL_INT_MESSAGE(count, ((TestStruct*)iterGetStack(&iterator))->num, "bottom up iteration out of order");
+        count++;
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(20, count, "bottom up iteration missed items");
+    destroyStack(stack);
+}
+
 int main(void) {
     UNITY_BEGIN();
     
@@ -186,6 +304,10 @@ int main(void) {
     RUN_TEST(test_empty_pop);
     RUN_TEST(test_multiple_pop_push);
     RUN_TEST(test_large_queue);
+    RUN_TEST(test_reserve);
+    RUN_TEST(test_shrink);
+    RUN_TEST(test_push_pop_many);
+    RUN_TEST(test_iterator);
 
     return UNITY_END();
 }
\ No newline at end of file
@@ -0,0 +1,141 @@
+#include "unity.h"
+#include "typedStack.h"
+
+/*
+ * Struct: Frame
+ * ----------------------------
+ * A struct stored by value in a typed stack.
+ */
+typedef struct frame{
+    int node;
+    int depth;
+}Frame;
+
+DEFINE_STACK(IntStack, int)
+DEFINE_STACK(FrameStack, Frame)
+
+void setUp(void) {
+    // set stuff up here
+
+}
+
+void tearDown(void) {
+    // clean stuff up here
+}
+
+/*
+ * Test: test_typed_stack_null
+ * ----------------------------
+ * Test that the typed stack functions handle NULL and empty stacks.
+ */
+void test_typed_stack_null(void){
+    IntStack * stack = createIntStack();
+    int value = 7;
+    TEST_ASSERT_NOT_NULL_MESSAGE(stack, "createIntStack returned NULL");
+    TEST_ASSERT_EQUAL_INT(0, pushIntStack(NULL, 1));
+    TEST_ASSERT_EQUAL_INT(0, popIntStack(NULL, &value));
+    TEST_ASSERT_EQUAL_INT(0, popIntStack(stack, &value));
+    TEST_ASSERT_EQUAL_INT_MESSAGE(7, value, "pop from an empty stack changed the value");
+    TEST_ASSERT_NULL(peekIntStack(stack));
+    TEST_ASSERT_EQUAL_INT(0, reserveIntStack(NULL, 10));
+    TEST_ASSERT_EQUAL_INT(0, reserveIntStack(stack, -1));
+    TEST_ASSERT_EQUAL_INT(0, destroyIntStack(NULL));
+    TEST_ASSERT_EQUAL_INT(1, destroyIntStack(stack));
+}
+
+/*
+ * Test: test_typed_stack_order
+ * ----------------------------
+ * Test that values come off in reverse order across growth, and that
+ *      reserve pre-sizes the array.
+ */
+void test_typed_stack_order(void){
+    IntStack * stack = createIntStack();
+    int value;
+    TEST_ASSERT_EQUAL_INT(1, reserveIntStack(stack, 100));
+    TEST_ASSERT_EQUAL_INT_MESSAGE(100, stack->capacity, "reserve did not grow the stack");
+    int * items = stack->items;
+    for(int i = 0; i < 100; i++){
+        pushIntStack(stack, i);
+    }
+    TEST_ASSERT_MESSAGE(items == stack->items, "stack reallocated within its reserved capacity");
+    for(int i = 100; i < 1000; i++){
+        pushIntStack(stack, i);
+    }
+    TEST_ASSERT_EQUAL_INT(1000, stack->size);
+    for(int i = 999; i >= 0; i--){
+        TEST_ASSERT_EQUAL_INT_MESSAGE(i, *peekIntStack(stack), "peek did not return the top value");
+        TEST_ASSERT_EQUAL_INT(1, popIntStack(stack, &value));
+        TEST_ASSERT_EQUAL_INT_MESSAGE(i, value, "popped out of order");
+    }
+    TEST_ASSERT_EQUAL_INT(0, popIntStack(stack, NULL));
+    destroyIntStack(stack);
+}
+
+/*
+ * Test: test_typed_stack_many
+ * ----------------------------
+ * Test that pushMany and popMany move runs of values in stack order and
+ *      that popMany stops at the bottom of the stack.
+ */
+void test_typed_stack_many(void){
+    IntStack * stack = createIntStack();
+    int values[100];
+    for(int i = 0; i < 100; i++){
+        values[i] = i;
+    }
+    TEST_ASSERT_EQUAL_INT(0, pushManyIntStack(NULL, values, 10));
+    TEST_ASSERT_EQUAL_INT(0, pushManyIntStack(stack, NULL, 10));
+    TEST_ASSERT_EQUAL_INT(1, pushManyIntStack(stack, values, 0));
+    TEST_ASSERT_EQUAL_INT(1, pushManyIntStack(stack, values, 100));
+    TEST_ASSERT_EQUAL_INT(1, pushIntStack(stack, 100));
+    TEST_ASSERT_EQUAL_INT(101, stack->size);
+    TEST_ASSERT_EQUAL_INT(0, popManyIntStack(stack, NULL, 10));
+    TEST_ASSERT_EQUAL_INT(10, popManyIntStack(stack, values, 10));
+    for(int i = 0; i < 10; i++){
+        TEST_ASSERT_EQUAL_INT_MESSAGE(100 - i, values[i], "popMany did not return the top value first");
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(91, popManyIntStack(stack, values, 100), "popMany did not stop at the bottom");
+    TEST_ASSERT_EQUAL_INT(0, values[90]);
+    TEST_ASSERT_EQUAL_INT(0, popManyIntStack(stack, values, 10));
+    destroyIntStack(stack);
+}
+
+/*
+ * Test: test_typed_stack_struct
+ * ----------------------------
+ * Test a depth first walk of an implicit binary tree using a stack of
+ *      structs stored by value.
+ */
+void test_typed_stack_struct(void){
+    FrameStack * stack = createFrameStack();
+    Frame frame = {1, 0};
+    int visited = 0;
+    int deepest = 0;
+    pushFrameStack(stack, frame);
+    while(popFrameStack(stack, &frame)){
+        visited++;
+        deepest = frame.depth > deepest ? frame.depth : deepest;
+        if(frame.node * 2 + 1 < 1024){
+            Frame left = {frame.node * 2, frame.depth + 1};
+            Frame right = {frame.node * 2 + 1, frame.depth + 1};
+            pushFrameStack(stack, right);
+            pushFrameStack(stack, left);
+        }
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1023, visited, "walk did not visit every node");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(9, deepest, "walk did not reach the deepest level");
+    destroyFrameStack(stack);
+}
+
+int main(void) {
+
+    UNITY_BEGIN();
+
+    RUN_TEST(test_typed_stack_null);
+    RUN_TEST(test_typed_stack_order);
+    RUN_TEST(test_typed_stack_many);
+    RUN_TEST(test_typed_stack_struct);
+
+    return UNITY_END();
+}
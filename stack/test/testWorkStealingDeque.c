@@ -0,0 +1,176 @@
+#include <pthread.h>
+#include "unity.h"
+#include "workStealingDeque.h"
+
+#define THIEVES 4
+#define ITEMS 400000
+#define BURST 32
+
+/*
+ * Struct: TestStruct
+ * ----------------------------
+ * A data structure used for testing
+ */
+typedef struct testingStruct{
+    int num;
+    char letter;
+}TestStruct;
+
+/*
+ * Function: createTestingStruct
+ * ----------------------------
+ * Allocates and sets a structure used for testing the WorkStealingDeque data structure.
+ *
+ * Created to keep DRY (Don't Repeated Yourself)
+ */
+TestStruct * createTestingStruct(int num, char c){
+    TestStruct * test = malloc(sizeof(TestStruct));
+    test->num = num;
+    test->letter = c;
+    return test;
+}
+
+void destroyFunc(void * data){
+    free(data);
+}
+
+void noDestroyFunc(void * data){
+}
+
+void setUp(void) {
+    // set stuff up here
+
+}
+
+void tearDown(void) {
+    // clean stuff up here
+}
+
+/*
+ * Test: test_create_work_stealing_deque
+ * ----------------------------
+ * Ensure the createWorkStealingDeque function works as expected and that
+ *      a NULL deque is handled gracefully.
+ */
+void test_create_work_stealing_deque(void){
+    WorkStealingDeque * deque = createWorkStealingDeque(&destroyFunc);
+    void * data;
+    TEST_ASSERT_NOT_NULL_MESSAGE(deque, "createWorkStealingDeque returned null pointer");
+    TEST_ASSERT_NULL_MESSAGE(popWorkStealing(deque), "new deque is not empty");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, stealWorkStealing(deque, &data), "steal from an empty deque did not fail");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, sizeWorkStealing(deque), "new deque has a size");
+    destroyWorkStealingDeque(deque);
+
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, pushWorkStealing(NULL, NULL), "NULL push did not fail");
+    TEST_ASSERT_NULL_MESSAGE(popWorkStealing(NULL), "NULL pop did not return NULL");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, stealWorkStealing(NULL, &data), "NULL steal did not fail");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(-1, sizeWorkStealing(NULL), "NULL size did not return -1");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, destroyWorkStealingDeque(NULL), "NULL destroy did not fail");
+}
+
+/*
+ * Test: test_work_stealing_order
+ * ----------------------------
+ * Test that the owner pops LIFO and thieves steal FIFO across the array
+ *      wrapping around and growing, and that destroy frees what is left.
+ */
+void test_work_stealing_order(void){
+    WorkStealingDeque * deque = createWorkStealingDeque(&destroyFunc);
+    int items = WS_INITIAL_CAPACITY * 4;
+    void * data;
+    TestStruct * test;
+    for(int i = 0; i < items; i++){
+        TEST_ASSERT_EQUAL_INT_MESSAGE(1, pushWorkStealing(deque, createTestingStruct(i, 'a')), "push failed");
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(items, sizeWorkStealing(deque), "size is incorrect after pushes");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(items, atomic_load(&deque->array)->capacity, "array did not grow to fit");
+    for(int i = 0; i < 10; i++){
+        TEST_ASSERT_EQUAL_INT_MESSAGE(1, stealWorkStealing(deque, &data), "steal failed");
+        test = data;
+        TEST_ASSERT_EQUAL_INT_MESSAGE(i, test->num, "steal did not take the oldest item");
+        free(test);
+    }
+    for(int i = items - 1; i >= items - 10; i--){
+        test = popWorkStealing(deque);
+        TEST_ASSERT_EQUAL_INT_MESSAGE(i, test->num, "pop did not take the newest item");
+        free(test);
+    }
+    for(int i = 0; i < 21; i++){
+        pushWorkStealing(deque, createTestingStruct(items + i, 'b'));
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(items * 2, atomic_load(&deque->array)->capacity, "array did not grow while wrapped around");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(1, stealWorkStealing(deque, &data), "steal failed after growing");
+    test = data;
+    TEST_ASSERT_EQUAL_INT_MESSAGE(10, test->num, "steal did not take the oldest item after growing");
+    free(test);
+    test = popWorkStealing(deque);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(items + 20, test->num, "pop did not take the newest item after growing");
+    free(test);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(items - 1, sizeWorkStealing(deque), "size is incorrect");
+    destroyWorkStealingDeque(deque);
+}
+
+WorkStealingDeque * sharedDeque;
+int taken[ITEMS];
+atomic_int ownerDone;
+
+void * thiefThread(void * arg){
+    void * data;
+    while(!atomic_load(&ownerDone) || sizeWorkStealing(sharedDeque) > 0){
+        if(stealWorkStealing(sharedDeque, &data) == 1){
+            (*(int*)data)++;
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Test: test_work_stealing_threads
+ * ----------------------------
+ * Test that items pushed and popped by the owner while thieves steal are
+ *      each taken exactly once.
+ */
+void test_work_stealing_threads(void){
+    pthread_t threads[THIEVES];
+    int * slot;
+    int missing = 0;
+    int duplicates = 0;
+
+    sharedDeque = createWorkStealingDeque(&noDestroyFunc);
+    atomic_store(&ownerDone, 0);
+    for(int i = 0; i < THIEVES; i++){
+        pthread_create(&threads[i], NULL, &thiefThread, NULL);
+    }
+    for(int i = 0; i < ITEMS; i += BURST){
+        for(int j = i; j < i + BURST && j < ITEMS; j++){
+            pushWorkStealing(sharedDeque, &taken[j]);
+        }
+        for(int j = 0; j < BURST / 2 && (slot = popWorkStealing(sharedDeque)) != NULL; j++){
+            (*slot)++;
+        }
+    }
+    while((slot = popWorkStealing(sharedDeque)) != NULL){
+        (*slot)++;
+    }
+    atomic_store(&ownerDone, 1);
+    for(int i = 0; i < THIEVES; i++){
+        pthread_join(threads[i], NULL);
+    }
+    for(int i = 0; i < ITEMS; i++){
+        missing += taken[i] == 0;
+        duplicates += taken[i] > 1;
+    }
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, missing, "items were lost");
+    TEST_ASSERT_EQUAL_INT_MESSAGE(0, duplicates, "items were taken more than once");
+    destroyWorkStealingDeque(sharedDeque);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_create_work_stealing_deque);
+    RUN_TEST(test_work_stealing_order);
+    RUN_TEST(test_work_stealing_threads);
+
+    return UNITY_END();
+}